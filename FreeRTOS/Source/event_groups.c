@@ -90,7 +90,15 @@ privileged Vs unprivileged linkage and placement. */
 /* The following bit fields convey control information in a task's event list
 item value.  It is important they don't clash with the
 taskEVENT_LIST_ITEM_VALUE_IN_USE definition. */
-#if configUSE_16_BIT_TICKS == 1
+#if( configUSE_FULL_EVENT_BITS == 1 )
+	// [ILG]
+	/* The control information is kept in a separate word of the waiting task's
+	EventWaiter_t, so no bits of the event group are reserved. */
+	#define eventCLEAR_EVENTS_ON_EXIT_BIT	0x01U
+	#define eventUNBLOCKED_DUE_TO_BIT_SET	0x02U
+	#define eventWAIT_FOR_ALL_BITS			0x04U
+	#define eventEVENT_BITS_CONTROL_BYTES	0U
+#elif configUSE_16_BIT_TICKS == 1
 	#define eventCLEAR_EVENTS_ON_EXIT_BIT	0x0100U
 	#define eventUNBLOCKED_DUE_TO_BIT_SET	0x0200U
 	#define eventWAIT_FOR_ALL_BITS			0x0400U
@@ -102,6 +110,68 @@ taskEVENT_LIST_ITEM_VALUE_IN_USE definition. */
 	#define eventEVENT_BITS_CONTROL_BYTES	0xff000000UL
 #endif
 
+// [ILG]
+/* When xEventGroupSetBitsFromISR() unblocks tasks directly, rather than via
+the timer service task, interrupts walk the lists of tasks waiting for bits.
+Task level code still walks them with only the scheduler suspended, so that the
+time spent with interrupts masked does not grow with the number of waiting
+tasks.  It locks the lists of the event group while it does, and an interrupt
+that finds them locked leaves the bits it sets for the task to set when it
+unlocks them.  Interrupts can still clear bits directly, so the event bits
+themselves are updated from short critical sections. */
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+	#define eventLOCK_WAITERS( pxEventBits )	( ( pxEventBits )->uxWaiterLocks )++
+	#define eventUNLOCK_WAITERS( pxEventBits )	prvUnlockWaiters( pxEventBits )
+	#define eventENTER_BITS_CRITICAL()			taskENTER_CRITICAL()
+	#define eventEXIT_BITS_CRITICAL()			taskEXIT_CRITICAL()
+#else
+	#define eventLOCK_WAITERS( pxEventBits )
+	#define eventUNLOCK_WAITERS( pxEventBits )
+	#define eventENTER_BITS_CRITICAL()
+	#define eventEXIT_BITS_CRITICAL()
+#endif
+
+// [ILG]
+#if( configUSE_FULL_EVENT_BITS == 1 )
+
+	/* With configUSE_FULL_EVENT_BITS the bits a task waits for do not fit in
+	its event list item value next to the control bits, so they are kept in a
+	record on the stack of the waiting task, which the task points to while it
+	is in the waiting list.  When the task is unblocked uxBitsWaitedFor is
+	replaced by the event group value and eventUNBLOCKED_DUE_TO_BIT_SET is set
+	in uxControlBits. */
+	typedef struct xEVENT_WAITER
+	{
+		EventBits_t uxBitsWaitedFor;
+		EventBits_t uxControlBits;
+	} EventWaiter_t;
+
+#endif
+
+// [ILG]
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+	#if( ( configEVENT_GROUP_WAITER_BUCKETS < 1 ) || ( configEVENT_GROUP_WAITER_BUCKETS > 32 ) )
+		#error configEVENT_GROUP_WAITER_BUCKETS must be between 1 and 32.
+	#endif
+
+	/* The bits of an event group are split into configEVENT_GROUP_WAITER_BUCKETS
+	equal ranges.  A task waiting only for bits within one range is kept in the
+	list of that range, any other task in xTasksWaitingForBits, so setting bits
+	only has to check the tasks of the ranges they fall in.  All the lists are
+	ordered by task priority. */
+	#define eventBITS_PER_BUCKET		( ( sizeof( EventBits_t ) * 8U ) / ( configEVENT_GROUP_WAITER_BUCKETS ) )
+	#define eventBUCKET_MASK( x )		( ( ~( EventBits_t ) 0U >> ( ( sizeof( EventBits_t ) * 8U ) - eventBITS_PER_BUCKET ) ) << ( ( x ) * eventBITS_PER_BUCKET ) )
+	#define eventNUM_WAITER_LISTS		( ( UBaseType_t ) ( configEVENT_GROUP_WAITER_BUCKETS ) + ( UBaseType_t ) 1U )
+	#define eventWAITER_LIST( pxEventBits, x )	( ( ( x ) == 0U ) ? &( ( pxEventBits )->xTasksWaitingForBits ) : &( ( pxEventBits )->xBucketWaitingForBits[ ( x ) - 1U ] ) )
+
+#else
+
+	#define eventNUM_WAITER_LISTS		( ( UBaseType_t ) 1U )
+	#define eventWAITER_LIST( pxEventBits, x )	( &( ( pxEventBits )->xTasksWaitingForBits ) )
+
+#endif
+
 typedef struct xEventGroupDefinition
 {
 	EventBits_t uxEventBits;
@@ -114,6 +184,21 @@ typedef struct xEventGroupDefinition
 	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 		uint8_t ucStaticallyAllocated; /*< Set to pdTRUE if the event group is statically allocated to ensure no attempt is made to free the memory. */
 	#endif
+
+	// [ILG]
+	#if( configUSE_MULTI_WAIT == 1 )
+		List_t xMultiWaiters;			/*< The waiter records of tasks blocked in xTaskWaitForMultiple() until bits are set.  Only accessed from critical sections. */
+	#endif
+
+	#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+		List_t xBucketWaitingForBits[ configEVENT_GROUP_WAITER_BUCKETS ];	/*< Lists of tasks waiting only for bits within one range of bits, see eventBUCKET_MASK(). */
+	#endif
+
+	// [ILG]
+	#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+		volatile UBaseType_t uxWaiterLocks;	/*< Non-zero while a task accesses the lists of waiting tasks with the scheduler suspended, see eventLOCK_WAITERS(). */
+		EventBits_t uxBitsSetFromISR;		/*< The bits set by interrupts while the lists were locked, to be set when they are unlocked.  Only accessed from critical sections. */
+	#endif
 } EventGroup_t;
 
 /*-----------------------------------------------------------*/
@@ -128,6 +213,63 @@ typedef struct xEventGroupDefinition
  */
 static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
 
+// [ILG]
+/*
+ * Return the bits the task owning pxListItem waits for, and store how it
+ * waits (eventCLEAR_EVENTS_ON_EXIT_BIT and eventWAIT_FOR_ALL_BITS) in
+ * *puxControlBits.
+ */
+static EventBits_t prvGetWaiterBits( const ListItem_t * const pxListItem, EventBits_t * const puxControlBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Record that the task owning pxListItem is unblocked because its bits
+ * matched while the event group value was uxEventBits.  Returns the value to
+ * store in the task's event list item when removing it from the waiting list.
+ */
+static TickType_t prvSetWaiterUnblocked( const ListItem_t * const pxListItem, const EventBits_t uxEventBits ) PRIVILEGED_FUNCTION;
+
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+	/*
+	 * Initialise the lists of the bit ranges of an event group.
+	 */
+	static void prvInitialiseBuckets( EventGroup_t * const pxEventBits ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the list into which a task waiting for uxBitsToWaitFor is placed.
+	 */
+	static List_t *prvGetWaiterList( EventGroup_t * const pxEventBits, const EventBits_t uxBitsToWaitFor ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Unblock the tasks whose wait condition is met after the bits uxBitsSet
+	 * were set, in priority order, checking only the lists that can hold such
+	 * tasks.  If pxYieldRequired is NULL the function is called from a task
+	 * with the scheduler suspended, otherwise from an interrupt, and
+	 * *pxYieldRequired is set to pdTRUE if an unblocked task has a priority
+	 * above that of the running task.  Returns the bits to clear on exit.
+	 */
+	static EventBits_t prvUnblockIndexedWaiters( EventGroup_t * const pxEventBits, const EventBits_t uxBitsSet, BaseType_t * const pxYieldRequired ) PRIVILEGED_FUNCTION;
+
+#endif
+
+// [ILG]
+/*
+ * Set the bits uxBitsToSet and unblock the tasks whose wait condition is then
+ * met.  Must be called with the scheduler suspended.
+ */
+static void prvSetBitsAndUnblock( EventGroup_t * const pxEventBits, const EventBits_t uxBitsToSet ) PRIVILEGED_FUNCTION;
+
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	/*
+	 * Undo one eventLOCK_WAITERS().  The outermost call first sets the bits
+	 * that interrupts left while the lists were locked.  Must be called with
+	 * the scheduler suspended.
+	 */
+	static void prvUnlockWaiters( EventGroup_t * const pxEventBits ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*-----------------------------------------------------------*/
 
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -147,6 +289,27 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, co
 			pxEventBits->uxEventBits = 0;
 			vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+			// [ILG]
+			#if( configUSE_MULTI_WAIT == 1 )
+			{
+				vListInitialise( &( pxEventBits->xMultiWaiters ) );
+			}
+			#endif
+
+			#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+			{
+				prvInitialiseBuckets( pxEventBits );
+			}
+			#endif
+
+			// [ILG]
+			#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+			{
+				pxEventBits->uxWaiterLocks = 0;
+				pxEventBits->uxBitsSetFromISR = 0;
+			}
+			#endif
+
 			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 			{
 				/* Both static and dynamic allocation can be used, so note that
@@ -183,6 +346,27 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, co
 			pxEventBits->uxEventBits = 0;
 			vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+			// [ILG]
+			#if( configUSE_MULTI_WAIT == 1 )
+			{
+				vListInitialise( &( pxEventBits->xMultiWaiters ) );
+			}
+			#endif
+
+			#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+			{
+				prvInitialiseBuckets( pxEventBits );
+			}
+			#endif
+
+			// [ILG]
+			#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+			{
+				pxEventBits->uxWaiterLocks = 0;
+				pxEventBits->uxBitsSetFromISR = 0;
+			}
+			#endif
+
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
 				/* Both static and dynamic allocation can be used, so note this
@@ -207,10 +391,13 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, co
 
 EventBits_t xEventGroupSync( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, const EventBits_t uxBitsToWaitFor, TickType_t xTicksToWait )
 {
-EventBits_t uxOriginalBitValue, uxReturn;
+EventBits_t uxOriginalBitValue, uxReturn, uxControlBits;
 EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
 BaseType_t xAlreadyYielded;
 BaseType_t xTimeoutOccurred = pdFALSE;
+#if( configUSE_FULL_EVENT_BITS == 1 )
+	EventWaiter_t xWaiter; // [ILG]
+#endif
 
 	configASSERT( ( uxBitsToWaitFor & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 	configASSERT( uxBitsToWaitFor != 0 );
@@ -221,6 +408,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 	#endif
 
 	vTaskSuspendAll();
+	eventLOCK_WAITERS( pxEventBits ); // [ILG]
 	{
 		uxOriginalBitValue = pxEventBits->uxEventBits;
 
@@ -233,7 +421,11 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 
 			/* Rendezvous always clear the bits.  They will have been cleared
 			already unless this is the only task in the rendezvous. */
-			pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
+			eventENTER_BITS_CRITICAL(); // [ILG]
+			{
+				pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
+			}
+			eventEXIT_BITS_CRITICAL(); // [ILG]
 
 			xTicksToWait = 0;
 		}
@@ -243,10 +435,32 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			{
 				traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor );
 
-				/* Store the bits that the calling task is waiting for in the
-				task's event list item so the kernel knows when a match is
-				found.  Then enter the blocked state. */
-				vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+				#if( configUSE_FULL_EVENT_BITS == 1 )
+				{
+					/* Store the bits that the calling task is waiting for in
+					its waiter record so the kernel knows when a match is
+					found.  Then enter the blocked state. */
+					xWaiter.uxBitsWaitedFor = uxBitsToWaitFor;
+					xWaiter.uxControlBits = eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS;
+					vTaskSetEventWaiter( &xWaiter );
+					#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+					{
+						vTaskPlaceOnEventList( prvGetWaiterList( pxEventBits, uxBitsToWaitFor ), xTicksToWait );
+					}
+					#else
+					{
+						vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), 0, xTicksToWait );
+					}
+					#endif
+				}
+				#else
+				{
+					/* Store the bits that the calling task is waiting for in the
+					task's event list item so the kernel knows when a match is
+					found.  Then enter the blocked state. */
+					vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+				}
+				#endif
 
 				/* This assignment is obsolete as uxReturn will get set after
 				the task unblocks, but some compilers mistakenly generate a
@@ -262,6 +476,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			}
 		}
 	}
+	eventUNLOCK_WAITERS( pxEventBits ); // [ILG]
 	xAlreadyYielded = xTaskResumeAll();
 
 	if( xTicksToWait != ( TickType_t ) 0 )
@@ -279,9 +494,22 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 		point either the required bits were set or the block time expired.  If
 		the required bits were set they will have been stored in the task's
 		event list item, and they should now be retrieved then cleared. */
-		uxReturn = uxTaskResetEventItemValue();
+		#if( configUSE_FULL_EVENT_BITS == 1 )
+		{
+			/* They were stored in the waiter record instead. */
+			( void ) uxTaskResetEventItemValue();
+			vTaskSetEventWaiter( NULL );
+			uxReturn = xWaiter.uxBitsWaitedFor;
+			uxControlBits = xWaiter.uxControlBits;
+		}
+		#else
+		{
+			uxReturn = uxTaskResetEventItemValue();
+			uxControlBits = uxReturn;
+		}
+		#endif
 
-		if( ( uxReturn & eventUNBLOCKED_DUE_TO_BIT_SET ) == ( EventBits_t ) 0 )
+		if( ( uxControlBits & eventUNBLOCKED_DUE_TO_BIT_SET ) == ( EventBits_t ) 0 )
 		{
 			/* The task timed out, just return the current event bit value. */
 			taskENTER_CRITICAL();
@@ -327,6 +555,9 @@ EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
 EventBits_t uxReturn, uxControlBits = 0;
 BaseType_t xWaitConditionMet, xAlreadyYielded;
 BaseType_t xTimeoutOccurred = pdFALSE;
+#if( configUSE_FULL_EVENT_BITS == 1 )
+	EventWaiter_t xWaiter; // [ILG]
+#endif
 
 	/* Check the user is not attempting to wait on the bits used by the kernel
 	itself, and that at least one bit is being requested. */
@@ -340,6 +571,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 	#endif
 
 	vTaskSuspendAll();
+	eventLOCK_WAITERS( pxEventBits ); // [ILG]
 	{
 		const EventBits_t uxCurrentEventBits = pxEventBits->uxEventBits;
 
@@ -356,7 +588,11 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			/* Clear the wait bits if requested to do so. */
 			if( xClearOnExit != pdFALSE )
 			{
-				pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
+				eventENTER_BITS_CRITICAL(); // [ILG]
+				{
+					pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
+				}
+				eventEXIT_BITS_CRITICAL(); // [ILG]
 			}
 			else
 			{
@@ -393,10 +629,32 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 				mtCOVERAGE_TEST_MARKER();
 			}
 
-			/* Store the bits that the calling task is waiting for in the
-			task's event list item so the kernel knows when a match is
-			found.  Then enter the blocked state. */
-			vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+			#if( configUSE_FULL_EVENT_BITS == 1 )
+			{
+				/* Store the bits that the calling task is waiting for in its
+				waiter record so the kernel knows when a match is found.  Then
+				enter the blocked state. */
+				xWaiter.uxBitsWaitedFor = uxBitsToWaitFor;
+				xWaiter.uxControlBits = uxControlBits;
+				vTaskSetEventWaiter( &xWaiter );
+				#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+				{
+					vTaskPlaceOnEventList( prvGetWaiterList( pxEventBits, uxBitsToWaitFor ), xTicksToWait );
+				}
+				#else
+				{
+					vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), 0, xTicksToWait );
+				}
+				#endif
+			}
+			#else
+			{
+				/* Store the bits that the calling task is waiting for in the
+				task's event list item so the kernel knows when a match is
+				found.  Then enter the blocked state. */
+				vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+			}
+			#endif
 
 			/* This is obsolete as it will get set after the task unblocks, but
 			some compilers mistakenly generate a warning about the variable
@@ -406,6 +664,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor );
 		}
 	}
+	eventUNLOCK_WAITERS( pxEventBits ); // [ILG]
 	xAlreadyYielded = xTaskResumeAll();
 
 	if( xTicksToWait != ( TickType_t ) 0 )
@@ -423,9 +682,22 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 		point either the required bits were set or the block time expired.  If
 		the required bits were set they will have been stored in the task's
 		event list item, and they should now be retrieved then cleared. */
-		uxReturn = uxTaskResetEventItemValue();
+		#if( configUSE_FULL_EVENT_BITS == 1 )
+		{
+			/* They were stored in the waiter record instead. */
+			( void ) uxTaskResetEventItemValue();
+			vTaskSetEventWaiter( NULL );
+			uxReturn = xWaiter.uxBitsWaitedFor;
+			uxControlBits = xWaiter.uxControlBits;
+		}
+		#else
+		{
+			uxReturn = uxTaskResetEventItemValue();
+			uxControlBits = uxReturn;
+		}
+		#endif
 
-		if( ( uxReturn & eventUNBLOCKED_DUE_TO_BIT_SET ) == ( EventBits_t ) 0 )
+		if( ( uxControlBits & eventUNBLOCKED_DUE_TO_BIT_SET ) == ( EventBits_t ) 0 )
 		{
 			taskENTER_CRITICAL();
 			{
@@ -496,7 +768,30 @@ EventBits_t uxReturn;
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+// [ILG]
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToClear )
+	{
+	EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
+	UBaseType_t uxSavedInterruptStatus;
+
+		configASSERT( xEventGroup );
+		configASSERT( ( uxBitsToClear & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+
+		/* Clearing bits never unblocks a task, so it is done in place, as
+		xEventGroupClearBits() does. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear );
+			pxEventBits->uxEventBits &= ~uxBitsToClear;
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return pdPASS;
+	}
+
+#elif ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
 	BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToClear )
 	{
@@ -529,39 +824,67 @@ EventBits_t uxReturn;
 
 EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet )
 {
-ListItem_t *pxListItem, *pxNext;
-ListItem_t const *pxListEnd;
-List_t *pxList;
-EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
 EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
-BaseType_t xMatchFound = pdFALSE;
 
 	/* Check the user is not attempting to set the bits used by the kernel
 	itself. */
 	configASSERT( xEventGroup );
 	configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 
-	pxList = &( pxEventBits->xTasksWaitingForBits );
-	pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
 	vTaskSuspendAll();
+	eventLOCK_WAITERS( pxEventBits ); // [ILG]
 	{
 		traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
-		pxListItem = listGET_HEAD_ENTRY( pxList );
+		prvSetBitsAndUnblock( pxEventBits, uxBitsToSet ); // [ILG]
+	}
+	eventUNLOCK_WAITERS( pxEventBits ); // [ILG]
+	( void ) xTaskResumeAll();
+
+	return pxEventBits->uxEventBits;
+}
+/*-----------------------------------------------------------*/
+
+// [ILG]
+static void prvSetBitsAndUnblock( EventGroup_t * const pxEventBits, const EventBits_t uxBitsToSet )
+{
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 0 )
+ListItem_t *pxListItem, *pxNext;
+ListItem_t const *pxListEnd;
+List_t *pxList;
+EventBits_t uxBitsWaitedFor, uxControlBits;
+BaseType_t xMatchFound = pdFALSE;
+#endif
+EventBits_t uxBitsToClear = 0;
 
-		/* Set the bits. */
+	/* Set the bits. */
+	eventENTER_BITS_CRITICAL();
+	{
 		pxEventBits->uxEventBits |= uxBitsToSet;
+	}
+	eventEXIT_BITS_CRITICAL();
+
+	// [ILG]
+	#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+	{
+		/* See if the new bit value should unblock any of the tasks that
+		may be waiting for the bits just set. */
+		uxBitsToClear = prvUnblockIndexedWaiters( pxEventBits, uxBitsToSet, NULL );
+	}
+	#else
+	{
+		pxList = &( pxEventBits->xTasksWaitingForBits );
+		pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+		pxListItem = listGET_HEAD_ENTRY( pxList );
 
 		/* See if the new bit value should unblock any tasks. */
 		while( pxListItem != pxListEnd )
 		{
 			pxNext = listGET_NEXT( pxListItem );
-			uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
 			xMatchFound = pdFALSE;
 
-			/* Split the bits waited for from the control bits. */
-			uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
-			uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+			/* Get the bits waited for and the control bits. */
+			uxBitsWaitedFor = prvGetWaiterBits( pxListItem, &uxControlBits ); // [ILG]
 
 			if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
 			{
@@ -602,7 +925,7 @@ BaseType_t xMatchFound = pdFALSE;
 				eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
 				that is was unblocked due to its required bits matching, rather
 				than because it timed out. */
-				( void ) xTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+				( void ) xTaskRemoveFromUnorderedEventList( pxListItem, prvSetWaiterUnblocked( pxListItem, pxEventBits->uxEventBits ) ); // [ILG]
 			}
 
 			/* Move onto the next list item.  Note pxListItem->pxNext is not
@@ -610,33 +933,123 @@ BaseType_t xMatchFound = pdFALSE;
 			and inserted into the ready/pending reading list. */
 			pxListItem = pxNext;
 		}
+	}
+	#endif /* configUSE_EVENT_GROUP_BIT_INDEX */
 
-		/* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
-		bit was set in the control word. */
-		pxEventBits->uxEventBits &= ~uxBitsToClear;
+	// [ILG]
+	#if( configUSE_MULTI_WAIT == 1 )
+	{
+		/* Wake the tasks blocked in xTaskWaitForMultiple() on any of the
+		bits just set.  They are held pending until the scheduler is
+		resumed, which yields if one of them has a higher priority. */
+		if( listLIST_IS_EMPTY( &( pxEventBits->xMultiWaiters ) ) == pdFALSE )
+		{
+			taskENTER_CRITICAL();
+			{
+				( void ) xTaskWakeMultiWaiters( &( pxEventBits->xMultiWaiters ), ( uint32_t ) uxBitsToSet );
+			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 	}
-	( void ) xTaskResumeAll();
+	#endif
 
-	return pxEventBits->uxEventBits;
+	/* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
+	bit was set in the control word. */
+	eventENTER_BITS_CRITICAL();
+	{
+		pxEventBits->uxEventBits &= ~uxBitsToClear;
+	}
+	eventEXIT_BITS_CRITICAL();
 }
 /*-----------------------------------------------------------*/
 
+// [ILG]
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	static void prvUnlockWaiters( EventGroup_t * const pxEventBits )
+	{
+	EventBits_t uxBitsSetFromISR;
+
+		if( pxEventBits->uxWaiterLocks > ( UBaseType_t ) 1 )
+		{
+			/* Nested in another lock, such as xEventGroupSetBits() called
+			from xEventGroupSync(), which sets the bits left by interrupts. */
+			( pxEventBits->uxWaiterLocks )--;
+		}
+		else
+		{
+			/* Setting the bits left by interrupts can take long enough for
+			interrupts to leave more, so only unlock once there are none. */
+			do
+			{
+				taskENTER_CRITICAL();
+				{
+					uxBitsSetFromISR = pxEventBits->uxBitsSetFromISR;
+					pxEventBits->uxBitsSetFromISR = 0;
+
+					if( uxBitsSetFromISR == ( EventBits_t ) 0 )
+					{
+						pxEventBits->uxWaiterLocks = 0;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				taskEXIT_CRITICAL();
+
+				if( uxBitsSetFromISR != ( EventBits_t ) 0 )
+				{
+					prvSetBitsAndUnblock( pxEventBits, uxBitsSetFromISR );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			} while( uxBitsSetFromISR != ( EventBits_t ) 0 );
+		}
+	}
+
+#endif /* configUSE_EVENT_GROUP_DIRECT_ISR */
+/*-----------------------------------------------------------*/
+
 void vEventGroupDelete( EventGroupHandle_t xEventGroup )
 {
 EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
-const List_t *pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
+const List_t *pxTasksWaitingForBits;
+UBaseType_t uxList;
+
+	// [ILG]
+	#if( configUSE_MULTI_WAIT == 1 )
+	{
+		/* An event group must not be deleted while a task is waiting on it in
+		xTaskWaitForMultiple(). */
+		configASSERT( listLIST_IS_EMPTY( &( pxEventBits->xMultiWaiters ) ) != pdFALSE );
+	}
+	#endif
 
 	vTaskSuspendAll();
 	{
 		traceEVENT_GROUP_DELETE( xEventGroup );
 
-		while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+		eventLOCK_WAITERS( pxEventBits ); // [ILG]
+		for( uxList = 0; uxList < eventNUM_WAITER_LISTS; uxList++ )
 		{
-			/* Unblock the task, returning 0 as the event list is being deleted
-			and	cannot therefore have any bits set. */
-			configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
-			( void ) xTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+			pxTasksWaitingForBits = eventWAITER_LIST( pxEventBits, uxList );
+
+			while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+			{
+				/* Unblock the task, returning 0 as the event list is being
+				deleted and cannot therefore have any bits set. */
+				configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
+				( void ) xTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, prvSetWaiterUnblocked( pxTasksWaitingForBits->xListEnd.pxNext, 0 ) ); // [ILG]
+			}
 		}
+		eventUNLOCK_WAITERS( pxEventBits ); // [ILG]
 
 		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
 		{
@@ -663,6 +1076,37 @@ const List_t *pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_MULTI_WAIT == 1 )
+
+	// [ILG]
+	BaseType_t xEventGroupAddMultiWaiter( EventGroupHandle_t xEventGroup, ListItem_t * const pxWaiterListItem, const EventBits_t uxBitsToWaitFor )
+	{
+	EventGroup_t * const pxEventBits = ( EventGroup_t * ) xEventGroup;
+	BaseType_t xReturn;
+
+		configASSERT( xEventGroup );
+		configASSERT( ( uxBitsToWaitFor & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+		configASSERT( uxBitsToWaitFor != 0 );
+
+		/* This function must be called from a critical section. */
+
+		if( ( pxEventBits->uxEventBits & uxBitsToWaitFor ) != ( EventBits_t ) 0 )
+		{
+			/* Nothing to wait for. */
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			vListInsertEnd( &( pxEventBits->xMultiWaiters ), pxWaiterListItem );
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTI_WAIT */
+/*-----------------------------------------------------------*/
+
 /* For internal use only - execute a 'set bits' command that was pended from
 an interrupt. */
 void vEventGroupSetBitsCallback( void *pvEventGroup, const uint32_t ulBitsToSet )
@@ -714,7 +1158,401 @@ BaseType_t xWaitConditionMet = pdFALSE;
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+// [ILG]
+static EventBits_t prvGetWaiterBits( const ListItem_t * const pxListItem, EventBits_t * const puxControlBits )
+{
+EventBits_t uxBitsWaitedFor;
+
+	#if( configUSE_FULL_EVENT_BITS == 1 )
+	{
+		const EventWaiter_t * const pxWaiter = ( const EventWaiter_t * ) pvTaskGetEventWaiter( ( TaskHandle_t ) listGET_LIST_ITEM_OWNER( pxListItem ) );
+
+		configASSERT( pxWaiter );
+		uxBitsWaitedFor = pxWaiter->uxBitsWaitedFor;
+		*puxControlBits = pxWaiter->uxControlBits;
+	}
+	#else
+	{
+		/* Split the bits waited for from the control bits. */
+		uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+		*puxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+		uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+	}
+	#endif
+
+	return uxBitsWaitedFor;
+}
+/*-----------------------------------------------------------*/
+
+// [ILG]
+static TickType_t prvSetWaiterUnblocked( const ListItem_t * const pxListItem, const EventBits_t uxEventBits )
+{
+TickType_t xItemValue;
+
+	#if( configUSE_FULL_EVENT_BITS == 1 )
+	{
+		EventWaiter_t * const pxWaiter = ( EventWaiter_t * ) pvTaskGetEventWaiter( ( TaskHandle_t ) listGET_LIST_ITEM_OWNER( pxListItem ) );
+
+		configASSERT( pxWaiter );
+		pxWaiter->uxBitsWaitedFor = uxEventBits;
+		pxWaiter->uxControlBits |= eventUNBLOCKED_DUE_TO_BIT_SET;
+
+		/* Nothing needs to be stored in the event list item. */
+		xItemValue = 0;
+	}
+	#else
+	{
+		/* Store the actual event flag value in the task's event list item.
+		The eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows that is
+		was unblocked due to its required bits matching, rather than because
+		it timed out. */
+		( void ) pxListItem;
+		xItemValue = uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET;
+	}
+	#endif
+
+	return xItemValue;
+}
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+	static void prvInitialiseBuckets( EventGroup_t * const pxEventBits )
+	{
+	UBaseType_t uxBucket;
+
+		for( uxBucket = 0; uxBucket < ( UBaseType_t ) configEVENT_GROUP_WAITER_BUCKETS; uxBucket++ )
+		{
+			vListInitialise( &( pxEventBits->xBucketWaitingForBits[ uxBucket ] ) );
+		}
+	}
+
+#endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+	static List_t *prvGetWaiterList( EventGroup_t * const pxEventBits, const EventBits_t uxBitsToWaitFor )
+	{
+	List_t *pxList = &( pxEventBits->xTasksWaitingForBits );
+	UBaseType_t uxBucket;
+
+		for( uxBucket = 0; uxBucket < ( UBaseType_t ) configEVENT_GROUP_WAITER_BUCKETS; uxBucket++ )
+		{
+			if( ( uxBitsToWaitFor & ~eventBUCKET_MASK( uxBucket ) ) == ( EventBits_t ) 0 )
+			{
+				pxList = &( pxEventBits->xBucketWaitingForBits[ uxBucket ] );
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return pxList;
+	}
+
+#endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+	static EventBits_t prvUnblockIndexedWaiters( EventGroup_t * const pxEventBits, const EventBits_t uxBitsSet, BaseType_t * const pxYieldRequired )
+	{
+	ListItem_t *pxCursors[ eventNUM_WAITER_LISTS ];
+	ListItem_t *pxListItem;
+	EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+	UBaseType_t uxList, uxNext;
+
+		/* Start at the head of the lists that can hold a task waiting for one
+		of the bits just set.  The tasks in the other lists wait only for bits
+		that did not change, so cannot have their condition met now. */
+		for( uxList = 0; uxList < eventNUM_WAITER_LISTS; uxList++ )
+		{
+			if( ( ( uxList == 0U ) || ( ( uxBitsSet & eventBUCKET_MASK( uxList - 1U ) ) != ( EventBits_t ) 0 ) ) &&
+				( listLIST_IS_EMPTY( eventWAITER_LIST( pxEventBits, uxList ) ) == pdFALSE ) )
+			{
+				pxCursors[ uxList ] = listGET_HEAD_ENTRY( eventWAITER_LIST( pxEventBits, uxList ) );
+			}
+			else
+			{
+				pxCursors[ uxList ] = NULL;
+			}
+		}
+
+		for( ;; )
+		{
+			/* The lists are ordered by priority, so the next task to check is
+			the one with the lowest item value at the head of a list. */
+			uxNext = eventNUM_WAITER_LISTS;
+
+			for( uxList = 0; uxList < eventNUM_WAITER_LISTS; uxList++ )
+			{
+				if( ( pxCursors[ uxList ] != NULL ) &&
+					( ( uxNext == eventNUM_WAITER_LISTS ) || ( listGET_LIST_ITEM_VALUE( pxCursors[ uxList ] ) < listGET_LIST_ITEM_VALUE( pxCursors[ uxNext ] ) ) ) )
+				{
+					uxNext = uxList;
+				}
+			}
+
+			if( uxNext == eventNUM_WAITER_LISTS )
+			{
+				break;
+			}
+
+			/* Move the cursor on before the item is moved to another list. */
+			pxListItem = pxCursors[ uxNext ];
+			pxCursors[ uxNext ] = listGET_NEXT( pxListItem );
+
+			if( pxCursors[ uxNext ] == ( ListItem_t * ) listGET_END_MARKER( eventWAITER_LIST( pxEventBits, uxNext ) ) ) /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+			{
+				pxCursors[ uxNext ] = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			uxBitsWaitedFor = prvGetWaiterBits( pxListItem, &uxControlBits );
+
+			if( prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsWaitedFor, ( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 ) ? pdTRUE : pdFALSE ) != pdFALSE )
+			{
+				if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+				{
+					uxBitsToClear |= uxBitsWaitedFor;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+				if( pxYieldRequired != NULL )
+				{
+					if( xTaskRemoveFromUnorderedEventListFromISR( pxListItem, prvSetWaiterUnblocked( pxListItem, pxEventBits->uxEventBits ) ) != pdFALSE )
+					{
+						*pxYieldRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				#endif /* configUSE_EVENT_GROUP_DIRECT_ISR */
+				{
+					( void ) pxYieldRequired;
+					( void ) xTaskRemoveFromUnorderedEventList( pxListItem, prvSetWaiterUnblocked( pxListItem, pxEventBits->uxEventBits ) );
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return uxBitsToClear;
+	}
+
+#endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
+	{
+	#if( configUSE_EVENT_GROUP_BIT_INDEX == 0 )
+		ListItem_t *pxListItem, *pxNext;
+		ListItem_t const *pxListEnd;
+		List_t *pxList;
+		EventBits_t uxBitsWaitedFor, uxControlBits;
+	#endif
+	EventBits_t uxBitsToClear = 0;
+	EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
+	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xReturn = pdPASS, xDirect = pdTRUE, xYieldRequired = pdFALSE;
+	#if( ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) && ( configUSE_64_BIT_EVENT_BITS == 0 ) )
+		UBaseType_t uxWaiters;
+		#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+			UBaseType_t uxList;
+		#endif
+	#endif
+
+		configASSERT( xEventGroup );
+		configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+
+		/* See the comment in xTaskGenericNotifyFromISR() about interrupt
+		priorities. */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
+
+			#if( ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) && ( configUSE_64_BIT_EVENT_BITS == 0 ) )
+			{
+				/* The time spent here with interrupts masked is bounded by the
+				number of waiting tasks that are checked.  Above the limit the
+				operation is handed to the timer service task, as it would be
+				without configUSE_EVENT_GROUP_DIRECT_ISR.  Without the timer
+				service task there is nowhere to defer to, and the limit is
+				only advisory.  Neither is there with 64-bit event bits, which
+				do not fit in the parameter passed to the timer service task. */
+				#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+				{
+					/* Only the tasks in the lists that are checked count. */
+					uxWaiters = listCURRENT_LIST_LENGTH( &( pxEventBits->xTasksWaitingForBits ) );
+
+					for( uxList = 0; uxList < ( UBaseType_t ) configEVENT_GROUP_WAITER_BUCKETS; uxList++ )
+					{
+						if( ( uxBitsToSet & eventBUCKET_MASK( uxList ) ) != ( EventBits_t ) 0 )
+						{
+							uxWaiters += listCURRENT_LIST_LENGTH( &( pxEventBits->xBucketWaitingForBits[ uxList ] ) );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+				}
+				#else
+				{
+					uxWaiters = listCURRENT_LIST_LENGTH( &( pxEventBits->xTasksWaitingForBits ) );
+				}
+				#endif
+
+				#if( configUSE_MULTI_WAIT == 1 )
+				{
+					uxWaiters += listCURRENT_LIST_LENGTH( &( pxEventBits->xMultiWaiters ) );
+				}
+				#endif
+
+				if( uxWaiters > ( UBaseType_t ) configEVENT_GROUP_MAX_ISR_WAITERS )
+				{
+					xDirect = pdFALSE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
+			if( xDirect == pdFALSE )
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+			else if( pxEventBits->uxWaiterLocks != ( UBaseType_t ) 0 )
+			{
+				/* A task is accessing the lists of waiting tasks with the
+				scheduler suspended.  It sets the bits, and unblocks the tasks
+				they release, when it unlocks the lists. */
+				pxEventBits->uxBitsSetFromISR |= uxBitsToSet;
+			}
+			else
+			{
+				/* Set the bits. */
+				pxEventBits->uxEventBits |= uxBitsToSet;
+
+				/* See if the new bit value should unblock any tasks, as in
+				xEventGroupSetBits(). */
+				#if( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+				{
+					uxBitsToClear = prvUnblockIndexedWaiters( pxEventBits, uxBitsToSet, &xYieldRequired );
+				}
+				#else
+				{
+					pxList = &( pxEventBits->xTasksWaitingForBits );
+					pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+
+					for( pxListItem = listGET_HEAD_ENTRY( pxList ); pxListItem != pxListEnd; pxListItem = pxNext )
+					{
+						/* Read before the item is moved to another list. */
+						pxNext = listGET_NEXT( pxListItem );
+
+						uxBitsWaitedFor = prvGetWaiterBits( pxListItem, &uxControlBits );
+
+						if( prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsWaitedFor, ( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 ) ? pdTRUE : pdFALSE ) != pdFALSE )
+						{
+							if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+							{
+								uxBitsToClear |= uxBitsWaitedFor;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+
+							if( xTaskRemoveFromUnorderedEventListFromISR( pxListItem, prvSetWaiterUnblocked( pxListItem, pxEventBits->uxEventBits ) ) != pdFALSE )
+							{
+								xYieldRequired = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+				}
+				#endif
+
+				#if( configUSE_MULTI_WAIT == 1 )
+				{
+					if( listLIST_IS_EMPTY( &( pxEventBits->xMultiWaiters ) ) == pdFALSE )
+					{
+						if( xTaskWakeMultiWaiters( &( pxEventBits->xMultiWaiters ), ( uint32_t ) uxBitsToSet ) != pdFALSE )
+						{
+							xYieldRequired = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
+				/* Clear any bits that matched when the
+				eventCLEAR_EVENTS_ON_EXIT_BIT bit was set in the control word. */
+				pxEventBits->uxEventBits &= ~uxBitsToClear;
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		if( xDirect == pdFALSE )
+		{
+			#if( ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) && ( configUSE_64_BIT_EVENT_BITS == 0 ) )
+			{
+				xReturn = xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken );
+			}
+			#endif
+		}
+		else if( ( xYieldRequired != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+		{
+			*pxHigherPriorityTaskWoken = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#elif ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
 	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
 	{
@@ -754,14 +1592,15 @@ BaseType_t xWaitConditionMet = pdFALSE;
 	BaseType_t xEventFlagsWaiting(void* xEventGroup)
 	{
 	  EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
-	  const List_t *pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
+	  UBaseType_t uxList;
 
-	  if (listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0)
+	  for (uxList = 0; uxList < eventNUM_WAITER_LISTS; uxList++)
 	  {
-	      return pdTRUE;
-	  }
-	  else
-	  {
-	      return pdFALSE;
+	      if (listCURRENT_LIST_LENGTH( eventWAITER_LIST( pxEventBits, uxList ) ) > ( UBaseType_t ) 0)
+	      {
+	          return pdTRUE;
+	      }
 	  }
+
+	  return pdFALSE;
 	}
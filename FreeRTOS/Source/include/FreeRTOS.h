@@ -744,6 +744,140 @@ extern "C" {
 	#define configUSE_TRACE_FACILITY 0
 #endif
 
+// [ILG]
+#ifndef configUSE_TASK_ITERATOR
+	#define configUSE_TASK_ITERATOR 0
+#endif
+
+#ifndef configUSE_TRACE_RECORDER
+	#define configUSE_TRACE_RECORDER 0
+#endif
+
+#ifndef configUSE_FAST_MUTEXES
+	#define configUSE_FAST_MUTEXES 0
+#endif
+
+#ifndef configUSE_QUEUE_ZERO_COPY
+	#define configUSE_QUEUE_ZERO_COPY 0
+#endif
+
+#ifndef configUSE_QUEUE_HANDOFF
+	#define configUSE_QUEUE_HANDOFF 0
+#endif
+
+#ifndef configUSE_SPSC_QUEUES
+	#define configUSE_SPSC_QUEUES 0
+#endif
+
+#ifndef configUSE_MULTI_WAIT
+	#define configUSE_MULTI_WAIT 0
+#endif
+
+#ifndef configUSE_EVENT_GROUP_DIRECT_ISR
+	#define configUSE_EVENT_GROUP_DIRECT_ISR 0
+#endif
+
+#ifndef configEVENT_GROUP_MAX_ISR_WAITERS
+	#define configEVENT_GROUP_MAX_ISR_WAITERS 8
+#endif
+
+#ifndef configUSE_FULL_EVENT_BITS
+	#define configUSE_FULL_EVENT_BITS 0
+#endif
+
+#ifndef configUSE_64_BIT_EVENT_BITS
+	#define configUSE_64_BIT_EVENT_BITS 0
+#endif
+
+#ifndef configUSE_EVENT_GROUP_BIT_INDEX
+	#define configUSE_EVENT_GROUP_BIT_INDEX 0
+#endif
+
+#ifndef configEVENT_GROUP_WAITER_BUCKETS
+	#define configEVENT_GROUP_WAITER_BUCKETS 4
+#endif
+
+#ifndef configUSE_TIMER_DIRECT_COMMANDS
+	#define configUSE_TIMER_DIRECT_COMMANDS 0
+#endif
+
+#ifndef configUSE_TIMER_WHEEL
+	#define configUSE_TIMER_WHEEL 0
+#endif
+
+#ifndef configTIMER_WHEEL_LEVELS
+	#if( configUSE_16_BIT_TICKS == 1 )
+		#define configTIMER_WHEEL_LEVELS 3
+	#else
+		#define configTIMER_WHEEL_LEVELS 4
+	#endif
+#endif
+
+#ifndef configUSE_TICK_TIMERS
+	#define configUSE_TICK_TIMERS 0
+#endif
+
+#ifndef configTICK_TIMER_MAX_RUN_TIME
+	#define configTICK_TIMER_MAX_RUN_TIME 0
+#endif
+
+#ifndef configTIMER_SERVICE_COUNT
+	#define configTIMER_SERVICE_COUNT 1
+#endif
+
+#ifndef configTIMER_SERVICE_PRIORITIES
+	#if( configTIMER_SERVICE_COUNT == 1 )
+		#define configTIMER_SERVICE_PRIORITIES { configTIMER_TASK_PRIORITY }
+	#else
+		#error configTIMER_SERVICE_PRIORITIES must list the priority of each of the configTIMER_SERVICE_COUNT timer service tasks.
+	#endif
+#endif
+
+#ifndef configUSE_TIMER_SLACK
+	#define configUSE_TIMER_SLACK 0
+#endif
+
+#ifndef configTASK_NOTIFICATION_ARRAY_ENTRIES
+	#define configTASK_NOTIFICATION_ARRAY_ENTRIES 1
+#endif
+
+#ifndef configUSE_TASK_NOTIFY_WAIT_BITS
+	#define configUSE_TASK_NOTIFY_WAIT_BITS 0
+#endif
+
+#ifndef configUSE_TASK_OBJECT_POINTER
+	#define configUSE_TASK_OBJECT_POINTER 0
+#endif
+
+#if( configTASK_NOTIFICATION_ARRAY_ENTRIES < 1 )
+	#error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1.
+#endif
+
+#if( ( configUSE_64_BIT_EVENT_BITS == 1 ) && ( configUSE_FULL_EVENT_BITS == 0 ) )
+	#error configUSE_64_BIT_EVENT_BITS requires configUSE_FULL_EVENT_BITS to be set to 1.
+#endif
+
+#if( ( configUSE_64_BIT_EVENT_BITS == 1 ) && ( configUSE_EVENT_GROUP_DIRECT_ISR == 0 ) )
+	/* The timer daemon callback that sets bits on behalf of an interrupt only
+	carries 32 bits. */
+	#error configUSE_64_BIT_EVENT_BITS requires configUSE_EVENT_GROUP_DIRECT_ISR to be set to 1.
+#endif
+
+#if( ( configUSE_EVENT_GROUP_BIT_INDEX == 1 ) && ( configUSE_FULL_EVENT_BITS == 0 ) )
+	/* The event list item value of a waiting task holds its priority, so the
+	bits it waits for must be held elsewhere. */
+	#error configUSE_EVENT_GROUP_BIT_INDEX requires configUSE_FULL_EVENT_BITS to be set to 1.
+#endif
+
+#if( ( configUSE_TICK_TIMERS == 1 ) && ( configUSE_TIMERS == 0 ) )
+	#error configUSE_TICK_TIMERS requires configUSE_TIMERS to be set to 1.
+#endif
+
+#if( ( configUSE_TICK_TIMERS == 1 ) && ( configUSE_TICKLESS_IDLE != 0 ) )
+	/* The idle time calculation does not take the tick timers into account. */
+	#error configUSE_TICK_TIMERS cannot be used with configUSE_TICKLESS_IDLE.
+#endif
+
 #ifndef mtCOVERAGE_TEST_MARKER
 	#define mtCOVERAGE_TEST_MARKER()
 #endif
@@ -797,6 +931,23 @@ extern "C" {
 	#error configUSE_MUTEXES must be set to 1 to use recursive mutexes
 #endif
 
+// [ILG]
+#if( ( configUSE_TASK_ITERATOR == 1 ) && ( configUSE_TRACE_FACILITY != 1 ) )
+	#error configUSE_TRACE_FACILITY must be set to 1 to use the task iterator
+#endif
+
+#if( ( configUSE_FAST_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error configUSE_MUTEXES must be set to 1 to use fast mutexes
+#endif
+
+#if( ( configUSE_SPSC_QUEUES == 1 ) && ( ( configUSE_TASK_NOTIFICATIONS != 1 ) || ( ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 ) ) ) )
+	#error configUSE_TASK_NOTIFICATIONS and INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to use SPSC queues
+#endif
+
+#if( ( configUSE_TASK_NOTIFY_WAIT_BITS == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+	#error configUSE_TASK_NOTIFY_WAIT_BITS requires configUSE_TASK_NOTIFICATIONS to be set to 1.
+#endif
+
 #if( portTICK_TYPE_IS_ATOMIC == 0 )
 	/* Either variables of tick type cannot be read atomically, or
 	portTICK_TYPE_IS_ATOMIC was not set - map the critical sections used when
@@ -932,8 +1083,28 @@ typedef struct xSTATIC_TCB
 	#if ( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t		uxDummy10[ 2 ];
 	#endif
+	#if ( configUSE_TASK_ITERATOR == 1 )
+		StaticListItem_t	xDummy11;
+	#endif
 	#if ( configUSE_MUTEXES == 1 )
 		UBaseType_t		uxDummy12[ 2 ];
+		StaticList_t	xDummy13;
+		void			*pxDummy13;
+	#endif
+	// [ILG]
+	#if ( configUSE_QUEUE_HANDOFF == 1 )
+		void			*pvDummy21;
+	#endif
+	#if ( configUSE_MULTI_WAIT == 1 )
+		void			*pvDummy22;
+		UBaseType_t		uxDummy23;
+		BaseType_t		xDummy24;
+	#endif
+	#if ( configUSE_FULL_EVENT_BITS == 1 )
+		void			*pvDummy25;
+	#endif
+	#if ( configUSE_TASK_OBJECT_POINTER == 1 )
+		void			*pvDummy28;
 	#endif
 	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
 		void			*pxDummy14;
@@ -948,12 +1119,18 @@ typedef struct xSTATIC_TCB
 		struct	_reent	xDummy17;
 	#endif
 	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
-		uint32_t 		ulDummy18;
-		uint8_t 		ucDummy19;
+		uint32_t 		ulDummy18[ configTASK_NOTIFICATION_ARRAY_ENTRIES ]; // [ILG]
+		uint8_t 		ucDummy19[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+		#if( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+			uint32_t	ulDummy26; // [ILG]
+		#endif
 	#endif
 	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 		uint8_t			uxDummy20;
 	#endif
+	#if( INCLUDE_xTaskAbortDelay == 1 )
+		uint8_t 		ucDummy27; // [ILG]
+	#endif
 
 } StaticTask_t;
 
@@ -989,6 +1166,11 @@ typedef struct xSTATIC_QUEUE
 		uint8_t ucDummy6;
 	#endif
 
+	// [ILG]
+	#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+		uint8_t ucDummy13;
+	#endif
+
 	#if ( configUSE_QUEUE_SETS == 1 )
 		void *pvDummy7;
 	#endif
@@ -998,9 +1180,71 @@ typedef struct xSTATIC_QUEUE
 		uint8_t ucDummy9;
 	#endif
 
+	#if ( configUSE_MUTEXES == 1 )
+		StaticListItem_t xDummy10;
+		void *pvDummy11;
+		UBaseType_t uxDummy12;
+	#endif
+
+	// [ILG]
+	#if ( configUSE_MULTI_WAIT == 1 )
+		StaticList_t xDummy14;
+	#endif
+
 } StaticQueue_t;
 typedef StaticQueue_t StaticSemaphore_t;
 
+// [ILG]
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the real fast mutex structure is not accessible to
+ * the application.  The StaticFastMutex_t structure below is provided so the
+ * memory for a fast mutex can be allocated statically.  Its size and alignment
+ * requirements are guaranteed to match those of the genuine structure.
+ */
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+	typedef struct xSTATIC_FAST_MUTEX
+	{
+		portPOINTER_SIZE_TYPE uxDummy1;
+		StaticList_t xDummy2;
+		StaticListItem_t xDummy3;
+		void *pvDummy4;
+		UBaseType_t uxDummy5;
+
+		#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+			uint8_t ucDummy6;
+		#endif
+
+	} StaticFastMutex_t;
+
+#endif /* configUSE_FAST_MUTEXES */
+
+// [ILG]
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the real SPSC queue structure is not accessible to
+ * the application.  The StaticSpscQueue_t structure below is provided so the
+ * memory for an SPSC queue can be allocated statically.  Its size and
+ * alignment requirements are guaranteed to match those of the genuine
+ * structure.
+ */
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+	typedef struct xSTATIC_SPSC_QUEUE
+	{
+		void *pvDummy1;
+		UBaseType_t uxDummy2[ 4 ];
+		void *pvDummy3;
+
+		#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+			uint8_t ucDummy4;
+		#endif
+
+	} StaticSpscQueue_t;
+
+#endif /* configUSE_SPSC_QUEUES */
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -1017,7 +1261,14 @@ typedef StaticQueue_t StaticSemaphore_t;
  */
 typedef struct xSTATIC_EVENT_GROUP
 {
-	TickType_t xDummy1;
+	// [ILG]
+	#if( configUSE_64_BIT_EVENT_BITS == 1 )
+		uint64_t xDummy1;
+	#elif( configUSE_FULL_EVENT_BITS == 1 )
+		uint32_t xDummy1;
+	#else
+		TickType_t xDummy1;
+	#endif
 	StaticList_t xDummy2;
 
 	#if( configUSE_TRACE_FACILITY == 1 )
@@ -1028,6 +1279,24 @@ typedef struct xSTATIC_EVENT_GROUP
 			uint8_t ucDummy4;
 	#endif
 
+	// [ILG]
+	#if ( configUSE_MULTI_WAIT == 1 )
+		StaticList_t xDummy5;
+	#endif
+	#if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+		StaticList_t xDummy6[ configEVENT_GROUP_WAITER_BUCKETS ];
+	#endif
+	#if ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+		UBaseType_t uxDummy7;
+		#if( configUSE_64_BIT_EVENT_BITS == 1 )
+			uint64_t xDummy8;
+		#elif( configUSE_FULL_EVENT_BITS == 1 )
+			uint32_t xDummy8;
+		#else
+			TickType_t xDummy8;
+		#endif
+	#endif
+
 } StaticEventGroup_t;
 
 /*
@@ -1059,6 +1328,17 @@ typedef struct xSTATIC_TIMER
 		uint8_t 		ucDummy7;
 	#endif
 
+	// [ILG]
+	#if( configUSE_TICK_TIMERS == 1 )
+		uint8_t 		ucDummy8;
+	#endif
+	#if( configTIMER_SERVICE_COUNT > 1 )
+		UBaseType_t		uxDummy9[ 2 ];
+	#endif
+	#if( configUSE_TIMER_SLACK == 1 )
+		TickType_t		xDummy10;
+	#endif
+
 } StaticTimer_t;
 
 // [ILG]
@@ -123,14 +123,23 @@ extern "C" {
 typedef void * EventGroupHandle_t;
 
 /*
- * The type that holds event bits always matches TickType_t - therefore the
- * number of bits it holds is set by configUSE_16_BIT_TICKS (16 bits if set to 1,
- * 32 bits if set to 0.
+ * The type that holds event bits matches TickType_t - therefore the number of
+ * bits it holds is set by configUSE_16_BIT_TICKS (16 bits if set to 1, 32 bits
+ * if set to 0.
+ *
+ * [ILG] If configUSE_FULL_EVENT_BITS is set to 1 the type is always 32 bits
+ * wide, or 64 bits wide if configUSE_64_BIT_EVENT_BITS is also set to 1.
  *
  * \defgroup EventBits_t EventBits_t
  * \ingroup EventGroup
  */
-typedef TickType_t EventBits_t;
+#if( configUSE_64_BIT_EVENT_BITS == 1 )
+	typedef uint64_t EventBits_t;
+#elif( configUSE_FULL_EVENT_BITS == 1 )
+	typedef uint32_t EventBits_t;
+#else
+	typedef TickType_t EventBits_t;
+#endif
 
 /**
  * event_groups.h
@@ -155,7 +164,9 @@ typedef TickType_t EventBits_t;
  * on the configUSE_16_BIT_TICKS setting in FreeRTOSConfig.h.  If
  * configUSE_16_BIT_TICKS is 1 then each event group contains 8 usable bits (bit
  * 0 to bit 7).  If configUSE_16_BIT_TICKS is set to 0 then each event group has
- * 24 usable bits (bit 0 to bit 23).  The EventBits_t type is used to store
+ * 24 usable bits (bit 0 to bit 23).  [ILG] If configUSE_FULL_EVENT_BITS is
+ * set to 1 all the bits of EventBits_t are usable, 32 or, with
+ * configUSE_64_BIT_EVENT_BITS, 64.  The EventBits_t type is used to store
  * event bits within an event group.
  *
  * @return If the event group was created then a handle to the event group is
@@ -211,7 +222,9 @@ typedef TickType_t EventBits_t;
  * on the configUSE_16_BIT_TICKS setting in FreeRTOSConfig.h.  If
  * configUSE_16_BIT_TICKS is 1 then each event group contains 8 usable bits (bit
  * 0 to bit 7).  If configUSE_16_BIT_TICKS is set to 0 then each event group has
- * 24 usable bits (bit 0 to bit 23).  The EventBits_t type is used to store
+ * 24 usable bits (bit 0 to bit 23).  [ILG] If configUSE_FULL_EVENT_BITS is
+ * set to 1 all the bits of EventBits_t are usable, 32 or, with
+ * configUSE_64_BIT_EVENT_BITS, 64.  The EventBits_t type is used to store
  * event bits within an event group.
  *
  * @param pxEventGroupBuffer pxEventGroupBuffer must point to a variable of type
@@ -410,6 +423,10 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup, const EventBit
  * timer task to have the clear operation performed in the context of the timer
  * task.
  *
+ * [ILG] If configUSE_EVENT_GROUP_DIRECT_ISR is set to 1 in FreeRTOSConfig.h
+ * the bits are instead cleared immediately, with interrupts masked, and the
+ * timer task is not involved.
+ *
  * @param xEventGroup The event group in which the bits are to be cleared.
  *
  * @param uxBitsToClear A bitwise value that indicates the bit or bits to clear.
@@ -445,7 +462,7 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup, const EventBit
  * \defgroup xEventGroupClearBitsFromISR xEventGroupClearBitsFromISR
  * \ingroup EventGroup
  */
-#if( configUSE_TRACE_FACILITY == 1 )
+#if( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 ) )
 	BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet ) PRIVILEGED_FUNCTION;
 #else
 	#define xEventGroupClearBitsFromISR( xEventGroup, uxBitsToClear ) xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToClear, NULL )
@@ -541,6 +558,20 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_
  * context of the timer task - where a scheduler lock is used in place of a
  * critical section.
  *
+ * [ILG] If configUSE_EVENT_GROUP_DIRECT_ISR is set to 1 in FreeRTOSConfig.h
+ * the bits are instead set immediately, and the tasks they unblock are readied
+ * directly from the interrupt, without a switch to the timer task.  To keep
+ * the time spent with interrupts masked bounded, this is only done while no
+ * more than configEVENT_GROUP_MAX_ISR_WAITERS tasks are waiting on the event
+ * group.  Beyond that the operation is passed to the timer task as above, if
+ * INCLUDE_xTimerPendFunctionCall and configUSE_TIMERS are set, and is
+ * otherwise still performed directly.  If the interrupt occurs while a task
+ * is itself accessing the waiting list of the event group, which tasks do with
+ * the scheduler suspended but interrupts enabled, the bits are instead set by
+ * that task, before it resumes the scheduler.  When the operation is performed
+ * directly *pxHigherPriorityTaskWoken is set to pdTRUE if a task with a
+ * priority above the interrupted task was unblocked, and pdPASS is returned.
+ *
  * @param xEventGroup The event group in which the bits are to be set.
  *
  * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
@@ -597,7 +628,7 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_
  * \defgroup xEventGroupSetBitsFromISR xEventGroupSetBitsFromISR
  * \ingroup EventGroup
  */
-#if( configUSE_TRACE_FACILITY == 1 )
+#if( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_ISR == 1 ) )
 	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 #else
 	#define xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken ) xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken )
@@ -783,6 +814,14 @@ void vEventGroupDelete( EventGroupHandle_t xEventGroup ) PRIVILEGED_FUNCTION;
 void vEventGroupSetBitsCallback( void *pvEventGroup, const uint32_t ulBitsToSet ) PRIVILEGED_FUNCTION;
 void vEventGroupClearBitsCallback( void *pvEventGroup, const uint32_t ulBitsToClear ) PRIVILEGED_FUNCTION;
 
+// [ILG]
+#if( configUSE_MULTI_WAIT == 1 )
+	/* Used by xTaskWaitForMultiple() to link a waiter record into the event
+	group, unless one of uxBitsToWaitFor is already set, in which case pdTRUE
+	is returned. */
+	BaseType_t xEventGroupAddMultiWaiter( EventGroupHandle_t xEventGroup, ListItem_t * const pxWaiterListItem, const EventBits_t uxBitsToWaitFor ) PRIVILEGED_FUNCTION;
+#endif
+
 
 #if (configUSE_TRACE_FACILITY == 1)
 	UBaseType_t uxEventGroupGetNumber( void* xEventGroup ) PRIVILEGED_FUNCTION;
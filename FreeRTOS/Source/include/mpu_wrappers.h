@@ -113,15 +113,19 @@ only for ports that are using the MPU. */
 		#define xTaskGetApplicationTaskTag				MPU_xTaskGetApplicationTaskTag
 		#define vTaskSetThreadLocalStoragePointer		MPU_vTaskSetThreadLocalStoragePointer
 		#define pvTaskGetThreadLocalStoragePointer		MPU_pvTaskGetThreadLocalStoragePointer
+		#define vTaskSetObjectPointer					MPU_vTaskSetObjectPointer
+		#define pvTaskGetObjectPointer					MPU_pvTaskGetObjectPointer
 		#define xTaskCallApplicationTaskHook			MPU_xTaskCallApplicationTaskHook
 		#define xTaskGetIdleTaskHandle					MPU_xTaskGetIdleTaskHandle
 		#define uxTaskGetSystemState					MPU_uxTaskGetSystemState
 		#define vTaskList								MPU_vTaskList
 		#define vTaskGetRunTimeStats					MPU_vTaskGetRunTimeStats
 		#define xTaskGenericNotify						MPU_xTaskGenericNotify
-		#define xTaskNotifyWait							MPU_xTaskNotifyWait
-		#define ulTaskNotifyTake						MPU_ulTaskNotifyTake
-		#define xTaskNotifyStateClear					MPU_xTaskNotifyStateClear
+		#define xTaskGenericNotifyWait					MPU_xTaskGenericNotifyWait
+		#define ulTaskGenericNotifyTake					MPU_ulTaskGenericNotifyTake
+		#define xTaskGenericNotifyStateClear			MPU_xTaskGenericNotifyStateClear
+		#define ulTaskGenericNotifyValueClear			MPU_ulTaskGenericNotifyValueClear
+		#define xTaskGenericNotifyWaitBits				MPU_xTaskGenericNotifyWaitBits
 
 		#define xTaskGetCurrentTaskHandle				MPU_xTaskGetCurrentTaskHandle
 		#define vTaskSetTimeOutState					MPU_vTaskSetTimeOutState
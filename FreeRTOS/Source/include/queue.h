@@ -101,6 +101,23 @@ typedef void * QueueSetHandle_t;
  */
 typedef void * QueueSetMemberHandle_t;
 
+// [ILG]
+/**
+ * Type by which fast mutexes are referenced.  For example, a call to
+ * xSemaphoreCreateFastMutex() returns a FastMutexHandle_t variable that can
+ * then be used as a parameter to xSemaphoreTakeFastMutex(), etc.
+ */
+typedef void * FastMutexHandle_t;
+
+// [ILG]
+/**
+ * Type by which single producer, single consumer queues are referenced.  For
+ * example, a call to xQueueCreateSpsc() returns an SpscQueueHandle_t variable
+ * that can then be used as a parameter to xQueueSendSpscFromISR(),
+ * xQueueReceiveSpsc(), etc.
+ */
+typedef void * SpscQueueHandle_t;
+
 /* For internal use only. */
 #define	queueSEND_TO_BACK		( ( BaseType_t ) 0 )
 #define	queueSEND_TO_FRONT		( ( BaseType_t ) 1 )
@@ -820,6 +837,530 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue, const void * const pvItemToQ
  */
 BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+// [ILG]
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueSendMultiple(
+								QueueHandle_t xQueue,
+								const void *pvItems,
+								UBaseType_t uxItemCount,
+								TickType_t xTicksToWait
+							);</pre>
+ *
+ * Post up to uxItemCount items to the back of a queue in a single call.  The
+ * items are copied, in order, from the contiguous array pvItems.  All the
+ * items that fit are copied within one critical section, with at most two
+ * memcpy() calls (the second only when the copy wraps around the end of the
+ * queue storage area), and the tasks waiting to receive are unblocked in the
+ * same pass - so a burst of N items costs one kernel entry rather than N.
+ *
+ * The call only blocks while the queue is completely full.  As soon as there
+ * is space for at least one item, as many items as fit are posted and the
+ * call returns, so fewer than uxItemCount items may be posted.
+ *
+ * This function must not be used with semaphores or mutexes.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItems A pointer to an array of uxItemCount items, each the size
+ * defined when the queue was created.
+ *
+ * @param uxItemCount The maximum number of items to post.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it be full.
+ *
+ * @return The number of items posted, which is 0 if the queue remained full
+ * for the whole block time.
+ *
+ * Example usage:
+   <pre>
+ #define BURST_LENGTH 64
+
+ void vAProducerTask( void *pvParameters )
+ {
+ uint16_t usSamples[ BURST_LENGTH ];
+ UBaseType_t uxSent;
+
+	for( ;; )
+	{
+		// ... Fill usSamples.
+
+		// Post the whole burst, blocking whenever the queue is full.
+		for( uxSent = 0; uxSent < BURST_LENGTH; )
+		{
+			uxSent += xQueueSendMultiple( xQueue, &( usSamples[ uxSent ] ), BURST_LENGTH - uxSent, portMAX_DELAY );
+		}
+	}
+ }
+ </pre>
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxItemCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+// [ILG]
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueSendMultipleFromISR(
+									QueueHandle_t xQueue,
+									const void *pvItems,
+									UBaseType_t uxItemCount,
+									BaseType_t *pxHigherPriorityTaskWoken
+								);</pre>
+ *
+ * A version of xQueueSendMultiple() that can be called from an interrupt
+ * service routine (ISR).  The items that fit are posted, the rest are not.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItems A pointer to an array of uxItemCount items.
+ *
+ * @param uxItemCount The maximum number of items to post.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueSendMultipleFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if posting the items caused a task to
+ * unblock, and the unblocked task has a priority higher than the currently
+ * running task.  If xQueueSendMultipleFromISR() sets this value to pdTRUE
+ * then a context switch should be requested before the interrupt is exited.
+ *
+ * @return The number of items posted, which is 0 if the queue was full.
+ *
+ * \defgroup xQueueSendMultipleFromISR xQueueSendMultipleFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+// [ILG]
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReceiveMultiple(
+								QueueHandle_t xQueue,
+								void *pvBuffer,
+								UBaseType_t uxItemCount,
+								TickType_t xTicksToWait
+							);</pre>
+ *
+ * Receive up to uxItemCount items from the front of a queue in a single
+ * call.  The items are copied, in order, into the contiguous array pvBuffer,
+ * within one critical section and with at most two memcpy() calls.  The tasks
+ * waiting for space on the queue are unblocked in the same pass.
+ *
+ * The call only blocks while the queue is empty.  As soon as at least one
+ * item is available, as many of the requested items as are available are
+ * received and the call returns, so fewer than uxItemCount items may be
+ * received.
+ *
+ * This function must not be used with semaphores or mutexes.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to a buffer large enough to hold uxItemCount items.
+ *
+ * @param uxItemCount The maximum number of items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive should the queue be empty.
+ *
+ * @return The number of items received, which is 0 if the queue remained
+ * empty for the whole block time.
+ *
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxItemCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+// [ILG]
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReceiveMultipleFromISR(
+									QueueHandle_t xQueue,
+									void *pvBuffer,
+									UBaseType_t uxItemCount,
+									BaseType_t *pxHigherPriorityTaskWoken
+								);</pre>
+ *
+ * A version of xQueueReceiveMultiple() that can be called from an interrupt
+ * service routine (ISR).
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to a buffer large enough to hold uxItemCount items.
+ *
+ * @param uxItemCount The maximum number of items to receive.
+ *
+ * @param pxHigherPriorityTaskWoken Tasks can be blocked waiting for space
+ * to become available on the queue.  If receiving the items causes such a
+ * task to unblock, and the unblocked task has a priority higher than the
+ * currently running task, *pxHigherPriorityTaskWoken will be set to pdTRUE.
+ *
+ * @return The number of items received, which is 0 if the queue was empty.
+ *
+ * \defgroup xQueueReceiveMultipleFromISR xQueueReceiveMultipleFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+// [ILG]
+#if( configUSE_QUEUE_ZERO_COPY == 1 )
+
+/**
+ * queue. h
+ * <pre>
+ void *pvQueueReserveSlot(
+							QueueHandle_t xQueue,
+							TickType_t xTicksToWait
+						);</pre>
+ *
+ * Reserve the slot of the queue storage area that the next item posted to
+ * the back of the queue would be copied to, so that the item can be built in
+ * place instead of being copied in.  Once the item is complete it is posted
+ * by calling vQueueCommitSlot().  Together with pvQueueAcquireSlot() and
+ * vQueueReleaseSlot() this moves large items through a queue without any copy.
+ *
+ * Blocks, as xQueueSend() does, while the queue is full.
+ *
+ * Only one slot can be reserved at a time, and while it is reserved no other
+ * task or interrupt may post to the queue.  The queue is intended to have a
+ * single writer.
+ *
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * pvQueueReserveSlot() to be available.
+ *
+ * @param xQueue The handle to the queue on which the item is to be posted.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it be full.
+ *
+ * @return A pointer to the reserved slot, which has the item size specified
+ * when the queue was created, or NULL if the queue remained full for the
+ * whole block time.
+ *
+ * Example usage:
+   <pre>
+ typedef struct AFrame
+ {
+	uint16_t usLength;
+	uint8_t ucData[ 510 ];
+ } Frame_t;
+
+ void vAProducerTask( void *pvParameters )
+ {
+ Frame_t *pxFrame;
+
+	// xQueue was created with xQueueCreate( 4, sizeof( Frame_t ) ).
+	for( ;; )
+	{
+		pxFrame = ( Frame_t * ) pvQueueReserveSlot( xQueue, portMAX_DELAY );
+
+		// Fill the frame directly in the queue storage area.
+		pxFrame->usLength = usReadFrame( pxFrame->ucData );
+
+		vQueueCommitSlot( xQueue );
+	}
+ }
+
+ void vAConsumerTask( void *pvParameters )
+ {
+ Frame_t *pxFrame;
+
+	for( ;; )
+	{
+		pxFrame = ( Frame_t * ) pvQueueAcquireSlot( xQueue, portMAX_DELAY );
+
+		// Process the frame where it lies.
+		vProcessFrame( pxFrame->ucData, pxFrame->usLength );
+
+		vQueueReleaseSlot( xQueue );
+	}
+ }
+ </pre>
+ * \defgroup pvQueueReserveSlot pvQueueReserveSlot
+ * \ingroup QueueManagement
+ */
+void *pvQueueReserveSlot( QueueHandle_t xQueue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>void vQueueCommitSlot( QueueHandle_t xQueue );</pre>
+ *
+ * Post the item built in the slot returned by pvQueueReserveSlot() to the
+ * back of the queue, unblocking a task waiting to receive from the queue, as
+ * xQueueSend() does.  The slot must not be accessed after it is committed.
+ *
+ * @param xQueue The handle to the queue on which the slot was reserved.
+ *
+ * \defgroup vQueueCommitSlot vQueueCommitSlot
+ * \ingroup QueueManagement
+ */
+void vQueueCommitSlot( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ void *pvQueueAcquireSlot(
+							QueueHandle_t xQueue,
+							TickType_t xTicksToWait
+						);</pre>
+ *
+ * Acquire the slot of the queue storage area that holds the item at the
+ * front of the queue, so that the item can be used in place instead of being
+ * copied out.  The item remains in the queue, and its slot cannot be reused,
+ * until it is removed by calling vQueueReleaseSlot().
+ *
+ * Blocks, as xQueueReceive() does, while the queue is empty.
+ *
+ * Only one slot can be acquired at a time, and while it is acquired no other
+ * task or interrupt may receive from or peek the queue, or post to its front.
+ * The queue is intended to have a single reader.
+ *
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for
+ * pvQueueAcquireSlot() to be available.
+ *
+ * @param xQueue The handle to the queue from which the item is to be
+ * received.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive should the queue be empty.
+ *
+ * @return A pointer to the acquired slot, or NULL if the queue remained empty
+ * for the whole block time.
+ *
+ * \defgroup pvQueueAcquireSlot pvQueueAcquireSlot
+ * \ingroup QueueManagement
+ */
+void *pvQueueAcquireSlot( QueueHandle_t xQueue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>void vQueueReleaseSlot( QueueHandle_t xQueue );</pre>
+ *
+ * Remove the item in the slot returned by pvQueueAcquireSlot() from the
+ * queue, unblocking a task waiting to post to the queue, as xQueueReceive()
+ * does.  The slot must not be accessed after it is released.
+ *
+ * @param xQueue The handle to the queue on which the slot was acquired.
+ *
+ * \defgroup vQueueReleaseSlot vQueueReleaseSlot
+ * \ingroup QueueManagement
+ */
+void vQueueReleaseSlot( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+
+// [ILG]
+#if( configUSE_SPSC_QUEUES == 1 )
+
+/**
+ * queue. h
+ * <pre>
+ SpscQueueHandle_t xQueueCreateSpsc(
+									UBaseType_t uxQueueLength,
+									UBaseType_t uxItemSize
+								);</pre>
+ *
+ * Creates a single producer, single consumer (SPSC) queue, and returns a
+ * handle by which the queue can be referenced.
+ *
+ * An SPSC queue is a separate object from an ordinary queue, for channels
+ * with exactly one writer, typically an interrupt, and exactly one reader
+ * task.  The writer and the reader each own one index into the storage area,
+ * so neither side masks interrupts or enters a critical section.  The kernel
+ * is only involved when the reader has to block on an empty queue, and when
+ * the writer then has to wake it, which it does with a direct to task
+ * notification.  The reader task must not use its notification value for
+ * anything else while it receives from an SPSC queue.
+ *
+ * Items are queued by copy.  The writer never blocks; sending to a full SPSC
+ * queue fails.
+ *
+ * configUSE_SPSC_QUEUES must be set to 1 in FreeRTOSConfig.h for SPSC queues
+ * to be available.
+ *
+ * @param uxQueueLength The maximum number of items that the queue can contain.
+ *
+ * @param uxItemSize The number of bytes each item in the queue will require.
+ *
+ * @return If the queue is successfully created then a handle to the newly
+ * created queue is returned.  If the queue cannot be created then 0 is
+ * returned.
+ *
+ * Example usage:
+   <pre>
+ SpscQueueHandle_t xRxQueue;
+
+ void vUartIsr( void )
+ {
+ uint8_t ucByte = UART_DATA;
+ BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	// Runs without touching the interrupt mask, unless the task is waiting.
+	xQueueSendSpscFromISR( xRxQueue, &ucByte, &xHigherPriorityTaskWoken );
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ }
+
+ void vATask( void *pvParameters )
+ {
+ uint8_t ucByte;
+
+	xRxQueue = xQueueCreateSpsc( 128, sizeof( uint8_t ) );
+
+	for( ;; )
+	{
+		if( xQueueReceiveSpsc( xRxQueue, &ucByte, portMAX_DELAY ) == pdPASS )
+		{
+			// Process ucByte.
+		}
+	}
+ }
+ </pre>
+ * \defgroup xQueueCreateSpsc xQueueCreateSpsc
+ * \ingroup QueueManagement
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	SpscQueueHandle_t xQueueCreateSpsc( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * <pre>
+ SpscQueueHandle_t xQueueCreateSpscStatic(
+									UBaseType_t uxQueueLength,
+									UBaseType_t uxItemSize,
+									uint8_t *pucQueueStorageBuffer,
+									StaticSpscQueue_t *pxQueueBuffer
+								);</pre>
+ *
+ * Creates an SPSC queue using memory provided by the application, as
+ * xQueueCreateStatic() does for ordinary queues.
+ *
+ * @param uxQueueLength The maximum number of items that the queue can contain.
+ *
+ * @param uxItemSize The number of bytes each item in the queue will require.
+ *
+ * @param pucQueueStorageBuffer Must point to a uint8_t array that is at least
+ * ( uxQueueLength * uxItemSize ) bytes, into which the items are copied.
+ *
+ * @param pxQueueBuffer Must point to a variable of type StaticSpscQueue_t,
+ * which will be used to hold the queue's data structure.
+ *
+ * @return A handle to the created queue.
+ *
+ * \defgroup xQueueCreateSpscStatic xQueueCreateSpscStatic
+ * \ingroup QueueManagement
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	SpscQueueHandle_t xQueueCreateSpscStatic( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorageBuffer, StaticSpscQueue_t *pxQueueBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * <pre>void vQueueDeleteSpsc( SpscQueueHandle_t xQueue );</pre>
+ *
+ * Delete an SPSC queue, freeing the memory if it was allocated dynamically.
+ *
+ * @param xQueue A handle to the queue to be deleted.
+ *
+ * \defgroup vQueueDeleteSpsc vQueueDeleteSpsc
+ * \ingroup QueueManagement
+ */
+void vQueueDeleteSpsc( SpscQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueSendSpscFromISR(
+									SpscQueueHandle_t xQueue,
+									const void *pvItemToQueue,
+									BaseType_t *pxHigherPriorityTaskWoken
+								);</pre>
+ *
+ * Post an item to the back of an SPSC queue.  Must only be called by the
+ * single writer of the queue.  Does not block, and does not mask interrupts
+ * unless the reader task has to be woken.
+ *
+ * @param xQueue The handle to the queue on which the item is to be posted.
+ *
+ * @param pvItemToQueue A pointer to the item that is to be placed on the
+ * queue.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if posting the item woke
+ * the reader task, and the reader task has a priority higher than the
+ * currently running task.
+ *
+ * @return pdPASS if the item was posted, otherwise errQUEUE_FULL.
+ *
+ * \defgroup xQueueSendSpscFromISR xQueueSendSpscFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueSendSpscFromISR( SpscQueueHandle_t xQueue, const void * const pvItemToQueue, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueSendSpsc(
+							SpscQueueHandle_t xQueue,
+							const void *pvItemToQueue
+						);</pre>
+ *
+ * A version of xQueueSendSpscFromISR() for when the writer is a task.  It
+ * yields if the reader task it woke has a higher priority.
+ *
+ * @return pdPASS if the item was posted, otherwise errQUEUE_FULL.
+ *
+ * \defgroup xQueueSendSpsc xQueueSendSpsc
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueSendSpsc( SpscQueueHandle_t xQueue, const void * const pvItemToQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReceiveSpsc(
+								SpscQueueHandle_t xQueue,
+								void *pvBuffer,
+								TickType_t xTicksToWait
+							);</pre>
+ *
+ * Receive an item from an SPSC queue.  Must only be called by the single
+ * reader task of the queue.
+ *
+ * @param xQueue The handle to the queue from which the item is to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received item will
+ * be copied.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive should the queue be empty.
+ *
+ * @return pdPASS if an item was received, otherwise errQUEUE_EMPTY.
+ *
+ * \defgroup xQueueReceiveSpsc xQueueReceiveSpsc
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReceiveSpsc( SpscQueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>UBaseType_t uxQueueSpscMessagesWaiting( const SpscQueueHandle_t xQueue );</pre>
+ *
+ * Return the number of items stored in an SPSC queue.  Can be called from
+ * either side, and from an interrupt.
+ *
+ * \defgroup uxQueueSpscMessagesWaiting uxQueueSpscMessagesWaiting
+ * \ingroup QueueManagement
+ */
+UBaseType_t uxQueueSpscMessagesWaiting( const SpscQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_SPSC_QUEUES */
+
 /**
  * queue. h
  * <pre>
@@ -1561,6 +2102,9 @@ QueueHandle_t xQueueCreateMutexStatic( const uint8_t ucQueueType, StaticQueue_t
 QueueHandle_t xQueueCreateCountingSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount ) PRIVILEGED_FUNCTION;
 QueueHandle_t xQueueCreateCountingSemaphoreStatic( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
 void* xQueueGetMutexHolder( QueueHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+void vQueueSetMutexPriorityCeiling( QueueHandle_t xMutex, UBaseType_t uxCeiling ) PRIVILEGED_FUNCTION;
+UBaseType_t uxQueueGetMutexPriorityCeiling( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
+BaseType_t xQueueResetSemaphoreCount( QueueHandle_t xSemaphore, const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
 
 /*
  * For internal use only.  Use xSemaphoreTakeMutexRecursive() or
@@ -1569,6 +2113,19 @@ void* xQueueGetMutexHolder( QueueHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
 BaseType_t xQueueTakeMutexRecursive( QueueHandle_t xMutex, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 BaseType_t xQueueGiveMutexRecursive( QueueHandle_t pxMutex ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Use the xSemaphore...FastMutex() macros instead of
+ * calling these functions directly.
+ */
+#if( configUSE_FAST_MUTEXES == 1 )
+	FastMutexHandle_t xQueueCreateFastMutex( void ) PRIVILEGED_FUNCTION;
+	FastMutexHandle_t xQueueCreateFastMutexStatic( StaticFastMutex_t *pxStaticMutex ) PRIVILEGED_FUNCTION;
+	void vQueueDeleteFastMutex( FastMutexHandle_t xMutex ) PRIVILEGED_FUNCTION;
+	BaseType_t xQueueTakeFastMutex( FastMutexHandle_t xMutex, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+	BaseType_t xQueueGiveFastMutex( FastMutexHandle_t xMutex ) PRIVILEGED_FUNCTION;
+	void* xQueueGetFastMutexHolder( FastMutexHandle_t xMutex ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Reset a queue back to its original empty state.  The return value is now
  * obsolete and is always set to pdPASS.
@@ -1789,6 +2346,14 @@ void vQueueSetQueueNumber( QueueHandle_t xQueue, UBaseType_t uxQueueNumber ) PRI
 UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 uint8_t ucQueueGetQueueType( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 
+// [ILG]
+#if( configUSE_MULTI_WAIT == 1 )
+	/* Used by xTaskWaitForMultiple() to link a waiter record into the queue,
+	unless the queue already holds data, in which case pdTRUE is returned. */
+	struct xLIST_ITEM;
+	BaseType_t xQueueAddMultiWaiter( QueueHandle_t xQueue, struct xLIST_ITEM * const pxWaiterListItem ) PRIVILEGED_FUNCTION;
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -1154,6 +1154,44 @@ typedef QueueHandle_t SemaphoreHandle_t;
  */
 #define xSemaphoreGetMutexHolder( xSemaphore ) xQueueGetMutexHolder( ( xSemaphore ) )
 
+/**
+ * semphr.h
+ * <pre>void vSemaphoreSetPriorityCeiling( SemaphoreHandle_t xMutex, UBaseType_t uxCeiling );</pre>
+ *
+ * Set the priority ceiling of a mutex type semaphore, switching it to the
+ * immediate priority ceiling protocol.  A task that takes the mutex is raised
+ * to the ceiling straight away, so no task that also uses the mutex can
+ * preempt it while it is held, and the mutex is normally found available
+ * without having to block.  The ceiling must therefore be at least the
+ * priority of the highest priority task that takes the mutex; taking the
+ * mutex from a task whose base priority is above the ceiling fails
+ * configASSERT().  Priority inheritance still applies on top of the ceiling.
+ *
+ * Setting the ceiling to tskIDLE_PRIORITY (the default) reverts the mutex to
+ * plain priority inheritance.  If the mutex is held, the new ceiling applies
+ * to the holder immediately.
+ *
+ * @param xMutex A handle to a mutex or recursive mutex type semaphore.
+ *
+ * @param uxCeiling The priority ceiling, less than configMAX_PRIORITIES.
+ *
+ * \defgroup vSemaphoreSetPriorityCeiling vSemaphoreSetPriorityCeiling
+ * \ingroup Semaphores
+ */
+#define vSemaphoreSetPriorityCeiling( xMutex, uxCeiling ) vQueueSetMutexPriorityCeiling( ( QueueHandle_t ) ( xMutex ), ( uxCeiling ) )
+
+/**
+ * semphr.h
+ * <pre>UBaseType_t uxSemaphoreGetPriorityCeiling( SemaphoreHandle_t xMutex );</pre>
+ *
+ * Return the priority ceiling of a mutex type semaphore, or tskIDLE_PRIORITY
+ * if the mutex only uses priority inheritance.
+ *
+ * \defgroup uxSemaphoreGetPriorityCeiling uxSemaphoreGetPriorityCeiling
+ * \ingroup Semaphores
+ */
+#define uxSemaphoreGetPriorityCeiling( xMutex ) uxQueueGetMutexPriorityCeiling( ( QueueHandle_t ) ( xMutex ) )
+
 /**
  * semphr.h
  * <pre>UBaseType_t uxSemaphoreGetCount( SemaphoreHandle_t xSemaphore );</pre>
@@ -1166,6 +1204,134 @@ typedef QueueHandle_t SemaphoreHandle_t;
  */
 #define uxSemaphoreGetCount( xSemaphore ) uxQueueMessagesWaiting( ( QueueHandle_t ) ( xSemaphore ) )
 
+// [ILG]
+/**
+ * semphr.h
+ * <pre>BaseType_t xSemaphoreResetCount( SemaphoreHandle_t xSemaphore, UBaseType_t uxCount );</pre>
+ *
+ * Set the count of a counting or binary semaphore to uxCount, in a single
+ * critical section.  The count is not changed if tasks are blocked taking the
+ * semaphore.  configUSE_COUNTING_SEMAPHORES must be set to 1 in
+ * FreeRTOSConfig.h for this macro to be available.
+ *
+ * @param xSemaphore A handle to the semaphore.
+ *
+ * @param uxCount The new count, at most the maximum count of the semaphore.
+ *
+ * @return pdPASS if the count was set, pdFAIL if tasks are blocked taking the
+ * semaphore.
+ *
+ * \defgroup xSemaphoreResetCount xSemaphoreResetCount
+ * \ingroup Semaphores
+ */
+#define xSemaphoreResetCount( xSemaphore, uxCount ) xQueueResetSemaphoreCount( ( QueueHandle_t ) ( xSemaphore ), ( uxCount ) )
+
+// [ILG]
+/**
+ * semphr. h
+ * <pre>FastMutexHandle_t xSemaphoreCreateFastMutex( void )</pre>
+ *
+ * Creates a fast mutex, and returns a handle by which the fast mutex can be
+ * referenced.  Only available when configUSE_FAST_MUTEXES is set to 1 in
+ * FreeRTOSConfig.h.
+ *
+ * A fast mutex keeps the handle of the holding task in a single owner word.
+ * When the mutex is not contended, xSemaphoreTakeFastMutex() and
+ * xSemaphoreGiveFastMutex() are a single atomic compare and swap on that word
+ * (using LDREX/STREX where available), without entering a critical section
+ * and without the queue locking protocol.  Only when a task has to wait is the
+ * mutex handed to the kernel, which then uses a wait list and priority
+ * inheritance exactly as for a standard mutex.
+ *
+ * Fast mutexes are not queues, they cannot be used with the other semaphore
+ * and queue API functions, nor in queue sets.  They are not recursive, cannot
+ * be used from interrupts, and do not support a priority ceiling.
+ *
+ * @return If the fast mutex was successfully created then a handle to the
+ * created fast mutex is returned.  If there was not enough heap to allocate
+ * the fast mutex data structures then NULL is returned.
+ *
+ * \defgroup xSemaphoreCreateFastMutex xSemaphoreCreateFastMutex
+ * \ingroup Semaphores
+ */
+#if( ( configUSE_FAST_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+	#define xSemaphoreCreateFastMutex() xQueueCreateFastMutex()
+#endif
+
+/**
+ * semphr. h
+ * <pre>FastMutexHandle_t xSemaphoreCreateFastMutexStatic( StaticFastMutex_t *pxMutexBuffer )</pre>
+ *
+ * Creates a fast mutex using statically allocated memory, and returns a handle
+ * by which the fast mutex can be referenced.
+ *
+ * @param pxMutexBuffer Must point to a variable of type StaticFastMutex_t,
+ * which will be used to hold the fast mutex's data structure.
+ *
+ * @return The handle of the created fast mutex.
+ *
+ * \defgroup xSemaphoreCreateFastMutexStatic xSemaphoreCreateFastMutexStatic
+ * \ingroup Semaphores
+ */
+#if( ( configUSE_FAST_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	#define xSemaphoreCreateFastMutexStatic( pxMutexBuffer ) xQueueCreateFastMutexStatic( ( pxMutexBuffer ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>BaseType_t xSemaphoreTakeFastMutex( FastMutexHandle_t xMutex, TickType_t xTicksToWait );</pre>
+ *
+ * Take a fast mutex.  Must not be called from an ISR.
+ *
+ * @param xMutex A handle to the fast mutex being taken.
+ *
+ * @param xTicksToWait The time in ticks to wait for the mutex to become
+ * available.
+ *
+ * @return pdTRUE if the mutex was obtained.  pdFALSE if xTicksToWait expired
+ * without the mutex becoming available.
+ *
+ * \defgroup xSemaphoreTakeFastMutex xSemaphoreTakeFastMutex
+ * \ingroup Semaphores
+ */
+#define xSemaphoreTakeFastMutex( xMutex, xBlockTime ) xQueueTakeFastMutex( ( xMutex ), ( xBlockTime ) )
+
+/**
+ * semphr. h
+ * <pre>BaseType_t xSemaphoreGiveFastMutex( FastMutexHandle_t xMutex );</pre>
+ *
+ * Give a fast mutex back.  Must be called by the task holding the mutex.
+ *
+ * @param xMutex A handle to the fast mutex being given.
+ *
+ * @return pdTRUE if the mutex was given.  pdFALSE if the calling task is not
+ * the holder of the mutex.
+ *
+ * \defgroup xSemaphoreGiveFastMutex xSemaphoreGiveFastMutex
+ * \ingroup Semaphores
+ */
+#define xSemaphoreGiveFastMutex( xMutex ) xQueueGiveFastMutex( ( xMutex ) )
+
+/**
+ * semphr. h
+ * <pre>void vSemaphoreDeleteFastMutex( FastMutexHandle_t xMutex );</pre>
+ *
+ * Delete a fast mutex.  Do not delete a fast mutex that is held by a task.
+ *
+ * \defgroup vSemaphoreDeleteFastMutex vSemaphoreDeleteFastMutex
+ * \ingroup Semaphores
+ */
+#define vSemaphoreDeleteFastMutex( xMutex ) vQueueDeleteFastMutex( ( xMutex ) )
+
+/**
+ * semphr.h
+ * <pre>TaskHandle_t xSemaphoreGetFastMutexHolder( FastMutexHandle_t xMutex );</pre>
+ *
+ * Return the task holding the fast mutex, or NULL if the mutex is available.
+ * The same caveats as for xSemaphoreGetMutexHolder() apply.
+ */
+#define xSemaphoreGetFastMutexHolder( xMutex ) xQueueGetFastMutexHolder( ( xMutex ) )
+
 #endif /* SEMAPHORE_H */
 
 
@@ -138,6 +138,42 @@ typedef struct xTIME_OUT
 	TickType_t xTimeOnEntering;
 } TimeOut_t;
 
+/*
+ * Used internally only.  Embedded in each mutex to link it into the list of
+ * mutexes held by its holder, and to give the scheduler access to the tasks
+ * waiting for the mutex, so priority inheritance can follow chains of mutexes.
+ * xHeldListItem must remain the first member.
+ */
+typedef struct xMUTEX_LINK
+{
+	ListItem_t xHeldListItem;	/*< Referenced from the list of mutexes held by the holding task, which is also the owner of the item. */
+	List_t *pxWaitingTasks;		/*< The list of tasks waiting to take the mutex, in priority order. */
+	UBaseType_t uxCeiling;		/*< The priority the holding task is raised to as soon as it takes the mutex, or tskIDLE_PRIORITY to only use priority inheritance. */
+} MutexLink_t;
+
+// [ILG]
+/* The kinds of object xTaskWaitForMultiple() can wait on. */
+typedef enum
+{
+	eWaitQueue = 0,			/* Ready when the queue or semaphore pvObject is not empty (or the mutex is available). */
+	eWaitEventGroup,		/* Ready when any of ulBits are set in the event group pvObject. */
+	eWaitNotification		/* Ready when any of ulBits are set in the notification value of the waiting task.  pvObject is not used. */
+} eWaitObjectType;
+
+/*
+ * One entry of the array passed to xTaskWaitForMultiple().  The application
+ * fills in eType, pvObject and ulBits.  xWaiterListItem is the waiter record
+ * the kernel links into the object while the task waits; it must not be
+ * touched by the application.
+ */
+typedef struct xWAIT_OBJECT
+{
+	eWaitObjectType eType;
+	void *pvObject;
+	uint32_t ulBits;
+	ListItem_t xWaiterListItem;
+} WaitObject_t;
+
 /*
  * Defines the memory ranges allocated to the task when an MPU is used.
  */
@@ -183,6 +219,16 @@ typedef struct xTASK_STATUS
 	uint16_t usStackHighWaterMark;	/* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
 } TaskStatus_t;
 
+// [ILG]
+/* Used with the xTaskIteratorNext() function to walk the tasks one at a time.
+The members are private to the kernel. */
+typedef struct xTASK_ITERATOR
+{
+	void *pvCursor;					/* The registry entry of the task last reported, or NULL before the first call. */
+	UBaseType_t uxLastTaskNumber;	/* The xTaskNumber of the task last reported. */
+	UBaseType_t uxGeneration;		/* The registry generation at the time of the last call. */
+} TaskIterator_t;
+
 // [ILG]
 #if defined ( __GNUC__ )
 #pragma GCC diagnostic pop
@@ -203,6 +249,15 @@ typedef enum
  */
 #define tskIDLE_PRIORITY			( ( UBaseType_t ) 0U )
 
+// [ILG]
+/**
+ * The index of the notification value used by the task notification functions
+ * that do not take an index, such as xTaskNotify() and ulTaskNotifyTake().
+ *
+ * \ingroup TaskNotifications
+ */
+#define tskDEFAULT_INDEX_TO_NOTIFY	( 0 )
+
 /**
  * task. h
  *
@@ -844,6 +899,24 @@ UBaseType_t uxTaskPriorityGet( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
  */
 UBaseType_t uxTaskPriorityGetFromISR( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <pre>UBaseType_t uxTaskBasePriorityGet( TaskHandle_t xTask );</pre>
+ *
+ * INCLUDE_uxTaskPriorityGet and configUSE_MUTEXES must be defined as 1 for
+ * this function to be available.
+ *
+ * Obtain the base priority of any task, that is the priority last assigned
+ * to it, without any priority inherited from or raised by the mutexes it
+ * holds.
+ *
+ * @param xTask Handle of the task to be queried.  Passing a NULL
+ * handle results in the base priority of the calling task being returned.
+ *
+ * @return The base priority of xTask.
+ */
+UBaseType_t uxTaskBasePriorityGet( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <pre>eTaskState eTaskGetState( TaskHandle_t xTask );</pre>
@@ -1418,6 +1491,31 @@ constant. */
 
 #endif
 
+// [ILG]
+#if( configUSE_TASK_OBJECT_POINTER == 1 )
+
+	/* Each task can hold a pointer to the application object that represents
+	it, for example the C++ thread object of an RTOS abstraction layer.  Unlike
+	the thread local storage pointers, the pointer of the running task can be
+	read inline with taskGET_CURRENT_OBJECT_POINTER(), which is a single load
+	from the current TCB, so it is suitable for the ownership checks done on
+	each mutex operation.  Passing xTask as NULL sets or queries the calling
+	task. */
+	void vTaskSetObjectPointer( TaskHandle_t xTask, void *pvObject ) PRIVILEGED_FUNCTION;
+	void *pvTaskGetObjectPointer( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+	/* The kernel files define pxCurrentTCB with the private type of the TCB,
+	the application reads it through the StaticTask_t mirror (the declaration
+	is the one some ports already use).  It is NULL until the first task is
+	created, and it is privileged data, so the macro cannot be used by
+	unprivileged tasks of MPU ports. */
+	#ifndef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+		extern volatile void * volatile pxCurrentTCB;
+		#define taskGET_CURRENT_OBJECT_POINTER() ( ( ( volatile StaticTask_t * ) pxCurrentTCB )->pvDummy28 )
+	#endif
+
+#endif
+
 /**
  * task.h
  * <pre>BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask, void *pvParameter );</pre>
@@ -1539,6 +1637,69 @@ TaskHandle_t xTaskGetIdleTaskHandle( void ) PRIVILEGED_FUNCTION;
  */
 UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
 
+// [ILG]
+/**
+ * configUSE_TRACE_FACILITY and configUSE_TASK_ITERATOR must both be defined
+ * as 1 in FreeRTOSConfig.h for the task iterator functions to be available.
+ *
+ * vTaskIteratorInit() prepares a TaskIterator_t for a new walk of all the
+ * tasks in the system.  Each subsequent call to xTaskIteratorNext() fills in
+ * the TaskStatus_t structure of the next task, in creation order, inside a
+ * short critical section that only covers that single task.  Unlike
+ * uxTaskGetSystemState(), the scheduler is not suspended for the walk (only,
+ * if requested, for the stack scan of one task), so monitoring code can poll
+ * the task states without adding jitter to the other tasks.
+ *
+ * The result is consistent per task, not across tasks.  A task created during
+ * the walk is reported if it was created after the task last reported; a task
+ * deleted during the walk is not reported after the deletion.  No task is
+ * reported twice.  Tasks that deleted themselves but are not yet cleaned up
+ * by the idle task are not reported.
+ *
+ * @param pxIterator The iterator to (re)initialise.
+ */
+void vTaskIteratorInit( TaskIterator_t * const pxIterator ) PRIVILEGED_FUNCTION;
+
+/**
+ * See vTaskIteratorInit().
+ *
+ * @param pxIterator An iterator initialised by vTaskIteratorInit().
+ *
+ * @param pxTaskStatus The structure to populate with the state of the next
+ * task.
+ *
+ * @param xGetFreeStackSpace The stack high water mark is computed by scanning
+ * the stack, which takes time proportional to the unused stack.  It is done
+ * after the critical section, with only the scheduler suspended.  Set to
+ * pdFALSE to skip it, in which case usStackHighWaterMark is set to 0.
+ *
+ * @return pdTRUE if pxTaskStatus was populated, pdFALSE if there are no more
+ * tasks to report.
+ *
+ * Example usage:
+   <pre>
+	TaskIterator_t xIterator;
+	TaskStatus_t xStatus;
+
+		vTaskIteratorInit( &xIterator );
+		while( xTaskIteratorNext( &xIterator, &xStatus, pdFALSE ) != pdFALSE )
+		{
+			// Process xStatus, possibly blocking between tasks.
+		}
+   </pre>
+ */
+BaseType_t xTaskIteratorNext( TaskIterator_t * const pxIterator, TaskStatus_t * const pxTaskStatus, const BaseType_t xGetFreeStackSpace ) PRIVILEGED_FUNCTION;
+
+/**
+ * A drop in replacement for uxTaskGetSystemState() built on the task iterator,
+ * so the scheduler is only suspended for the stack scan of one task at a time,
+ * and interrupts are only masked while the state of one task is copied.  If the
+ * array is too small the first uxArraySize tasks are returned, rather than
+ * none.  vTaskList() and vTaskGetRunTimeStats() use this function when
+ * configUSE_TASK_ITERATOR is 1.
+ */
+UBaseType_t uxTaskGetSystemStateIncremental( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <PRE>void vTaskList( char *pcWriteBuffer );</PRE>
@@ -1671,6 +1832,20 @@ void vTaskGetRunTimeStats( char *pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e9
  * to wait for its notification value to have a non-zero value.  The task does
  * not consume any CPU time while it is in the Blocked state.
  *
+ * [ILG] Each task has configTASK_NOTIFICATION_ARRAY_ENTRIES notification
+ * values, each with its own pending state, so notifications can be used for
+ * unrelated purposes in the same task, for example as a binary semaphore and
+ * to receive CMSIS-RTOS signals.  Every notification function has a variant
+ * with "Indexed" in its name that takes the index of the notification value as
+ * an extra parameter after the task handle, or as the first parameter for the
+ * functions that wait, such as xTaskNotifyIndexed( xTaskToNotify,
+ * uxIndexToNotify, ulValue, eAction ) and ulTaskNotifyTakeIndexed(
+ * uxIndexToWaitOn, xClearCountOnExit, xTicksToWait ).  A task blocked on one
+ * index is only unblocked by notifications sent to that index.  The functions
+ * without an index use tskDEFAULT_INDEX_TO_NOTIFY, which is also the only
+ * index xTaskWaitForMultiple() looks at.  configTASK_NOTIFICATION_ARRAY_ENTRIES
+ * defaults to 1.
+ *
  * See http://www.FreeRTOS.org/RTOS-task-notifications.html for details.
  *
  * @param xTaskToNotify The handle of the task being notified.  The handle to a
@@ -1719,9 +1894,11 @@ void vTaskGetRunTimeStats( char *pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e9
  * \defgroup xTaskNotify xTaskNotify
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue ) PRIVILEGED_FUNCTION;
-#define xTaskNotify( xTaskToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( ulValue ), ( eAction ), NULL )
-#define xTaskNotifyAndQuery( xTaskToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
+BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue ) PRIVILEGED_FUNCTION;
+#define xTaskNotify( xTaskToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), NULL )
+#define xTaskNotifyIndexed( xTaskToNotify, uxIndexToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), NULL )
+#define xTaskNotifyAndQuery( xTaskToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
+#define xTaskNotifyAndQueryIndexed( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
 
 /**
  * task. h
@@ -1810,9 +1987,11 @@ BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNo
  * \defgroup xTaskNotify xTaskNotify
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
-#define xTaskNotifyFromISR( xTaskToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
-#define xTaskNotifyAndQueryFromISR( xTaskToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
+BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyFromISR( xTaskToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
+#define xTaskNotifyIndexedFromISR( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
+#define xTaskNotifyAndQueryFromISR( xTaskToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
+#define xTaskNotifyAndQueryIndexedFromISR( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
 
 /**
  * task. h
@@ -1887,7 +2066,9 @@ BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulVal
  * \defgroup xTaskNotifyWait xTaskNotifyWait
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyWait( ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait ) xTaskGenericNotifyWait( ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) )
+#define xTaskNotifyWaitIndexed( uxIndexToWaitOn, ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait ) xTaskGenericNotifyWait( ( uxIndexToWaitOn ), ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) )
 
 /**
  * task. h
@@ -1933,7 +2114,8 @@ BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClea
  * \defgroup xTaskNotifyGive xTaskNotifyGive
  * \ingroup TaskNotifications
  */
-#define xTaskNotifyGive( xTaskToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( 0 ), eIncrement, NULL )
+#define xTaskNotifyGive( xTaskToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( 0 ), eIncrement, NULL )
+#define xTaskNotifyGiveIndexed( xTaskToNotify, uxIndexToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( 0 ), eIncrement, NULL )
 
 /**
  * task. h
@@ -1988,7 +2170,9 @@ BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClea
  * \defgroup xTaskNotifyWait xTaskNotifyWait
  * \ingroup TaskNotifications
  */
-void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#define vTaskNotifyGiveFromISR( xTaskToNotify, pxHigherPriorityTaskWoken ) vTaskGenericNotifyGiveFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( pxHigherPriorityTaskWoken ) )
+#define vTaskNotifyGiveIndexedFromISR( xTaskToNotify, uxIndexToNotify, pxHigherPriorityTaskWoken ) vTaskGenericNotifyGiveFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( pxHigherPriorityTaskWoken ) )
 
 /**
  * task. h
@@ -2057,7 +2241,9 @@ void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPri
  * \defgroup ulTaskNotifyTake ulTaskNotifyTake
  * \ingroup TaskNotifications
  */
-uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWaitOn, BaseType_t xClearCountOnExit, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#define ulTaskNotifyTake( xClearCountOnExit, xTicksToWait ) ulTaskGenericNotifyTake( ( tskDEFAULT_INDEX_TO_NOTIFY ), ( xClearCountOnExit ), ( xTicksToWait ) )
+#define ulTaskNotifyTakeIndexed( uxIndexToWaitOn, xClearCountOnExit, xTicksToWait ) ulTaskGenericNotifyTake( ( uxIndexToWaitOn ), ( xClearCountOnExit ), ( xTicksToWait ) )
 
 /**
  * task. h
@@ -2073,7 +2259,159 @@ uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait
  * \defgroup xTaskNotifyStateClear xTaskNotifyStateClear
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask );
+BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyStateClear( xTask ) xTaskGenericNotifyStateClear( ( xTask ), ( tskDEFAULT_INDEX_TO_NOTIFY ) )
+#define xTaskNotifyStateClearIndexed( xTask, uxIndexToClear ) xTaskGenericNotifyStateClear( ( xTask ), ( uxIndexToClear ) )
+
+// [ILG]
+/**
+ * task. h
+ * <PRE>uint32_t ulTaskNotifyValueClear( TaskHandle_t xTask, uint32_t ulBitsToClear );</pre>
+ *
+ * Clear the bits set in ulBitsToClear in the notification value of the task
+ * referenced by xTask, in a single critical section.  The notification state
+ * is not altered.  Set xTask to NULL to clear bits in the notification value
+ * of the calling task.
+ *
+ * ulTaskNotifyValueClearIndexed() does the same on the notification value at
+ * array index uxIndexToClear.
+ *
+ * @return The task's notification value before any bits were cleared.
+ *
+ * \defgroup ulTaskNotifyValueClear ulTaskNotifyValueClear
+ * \ingroup TaskNotifications
+ */
+uint32_t ulTaskGenericNotifyValueClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear, uint32_t ulBitsToClear ) PRIVILEGED_FUNCTION;
+#define ulTaskNotifyValueClear( xTask, ulBitsToClear ) ulTaskGenericNotifyValueClear( ( xTask ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulBitsToClear ) )
+#define ulTaskNotifyValueClearIndexed( xTask, uxIndexToClear, ulBitsToClear ) ulTaskGenericNotifyValueClear( ( xTask ), ( uxIndexToClear ), ( ulBitsToClear ) )
+
+// [ILG]
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskNotifyWaitBits( uint32_t ulBitsToWaitFor, BaseType_t xClearOnExit, BaseType_t xWaitForAllBits, uint32_t *pulNotificationValue, TickType_t xTicksToWait );</pre>
+ *
+ * configUSE_TASK_NOTIFY_WAIT_BITS must be set to 1 in FreeRTOSConfig.h for
+ * this function to be available.
+ *
+ * Wait for bits in the calling task's notification value to become set, in
+ * the same way xEventGroupWaitBits() waits on an event group.  Unlike
+ * xTaskNotifyWait(), which returns as soon as any notification is received,
+ * the task is only unblocked once ( value & ulBitsToWaitFor ) is non zero
+ * (xWaitForAllBits set to pdFALSE) or equal to ulBitsToWaitFor
+ * (xWaitForAllBits set to pdTRUE).  Notifications that do not satisfy the
+ * condition update the value but leave the task blocked, so a task waiting
+ * for a subset of the bits used as flags is not woken by the others.
+ *
+ * The bits that satisfied the wait can be cleared in the same critical
+ * section that tests them, so that bits set by a notifier between the test
+ * and the clear are never lost.  Bits not in ulBitsToWaitFor are left
+ * unchanged.  Any notification that was pending when the function was called
+ * is consumed, as it is by xTaskNotifyWait().
+ *
+ * xTaskNotifyWaitBitsIndexed() does the same on the notification value at
+ * array index uxIndexToWaitOn.
+ *
+ * @param ulBitsToWaitFor The bits to wait for.  Must not be 0.
+ *
+ * @param xClearOnExit If xClearOnExit is pdTRUE and the wait condition was
+ * met, the bits set in ulBitsToWaitFor are cleared in the task's notification
+ * value before the function returns.  They are left unchanged on a timeout.
+ *
+ * @param xWaitForAllBits pdTRUE to wait for all the bits in ulBitsToWaitFor,
+ * pdFALSE to wait for any of them.
+ *
+ * @param pulNotificationValue Used to pass the task's notification value out
+ * of the function, before any bits are cleared.  Can be NULL.
+ *
+ * @param xTicksToWait The maximum amount of time to wait for the condition to
+ * be met, in ticks.
+ *
+ * @return pdTRUE if the condition was met, otherwise pdFALSE.
+ *
+ * \defgroup xTaskNotifyWaitBits xTaskNotifyWaitBits
+ * \ingroup TaskNotifications
+ */
+BaseType_t xTaskGenericNotifyWaitBits( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToWaitFor, BaseType_t xClearOnExit, BaseType_t xWaitForAllBits, uint32_t *pulNotificationValue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyWaitBits( ulBitsToWaitFor, xClearOnExit, xWaitForAllBits, pulNotificationValue, xTicksToWait ) xTaskGenericNotifyWaitBits( ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulBitsToWaitFor ), ( xClearOnExit ), ( xWaitForAllBits ), ( pulNotificationValue ), ( xTicksToWait ) )
+#define xTaskNotifyWaitBitsIndexed( uxIndexToWaitOn, ulBitsToWaitFor, xClearOnExit, xWaitForAllBits, pulNotificationValue, xTicksToWait ) xTaskGenericNotifyWaitBits( ( uxIndexToWaitOn ), ( ulBitsToWaitFor ), ( xClearOnExit ), ( xWaitForAllBits ), ( pulNotificationValue ), ( xTicksToWait ) )
+
+// [ILG]
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskWaitForMultiple( WaitObject_t *pxObjects, UBaseType_t uxObjectCount, TickType_t xTicksToWait );</pre>
+ *
+ * configUSE_MULTI_WAIT must be set to 1 in FreeRTOSConfig.h for this function
+ * to be available.
+ *
+ * Block the calling task once on a mixed set of objects, until one of them
+ * is ready: a queue or semaphore that is not empty, an event group with any
+ * of a mask of bits set, or any of a mask of bits set in the task's own
+ * notification value.  Unlike a queue set, the objects are not members of
+ * anything, and posting to them involves no extra queue: while the task waits
+ * each object holds a waiter record (the xWaiterListItem of the entry) that
+ * the kernel follows to wake the task directly, noting which object woke it.
+ *
+ * Being woken only means the object became ready.  As with a queue set, the
+ * task still has to receive from the queue, take the semaphore, clear the
+ * event bits or read the notification value, with a block time of zero, and
+ * must be prepared for that to fail if another task got there first.
+ *
+ * The array, which may be on the calling task's stack, must remain valid and
+ * unchanged until the function returns.  A queue, semaphore or event group
+ * must not be deleted while a task is waiting on it.
+ *
+ * @param pxObjects The array of objects to wait on.
+ *
+ * @param uxObjectCount The number of entries in pxObjects.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for one of the objects to become ready.
+ *
+ * @return The index in pxObjects of the object found ready, or -1 if none
+ * became ready within the block time.  When several objects are ready at the
+ * time of the call the one with the lowest index is reported.
+ *
+ * Example usage:
+   <pre>
+ void vADispatcherTask( void *pvParameters )
+ {
+ WaitObject_t xObjects[ 3 ];
+ uint32_t ulCommand;
+
+	xObjects[ 0 ].eType = eWaitQueue;
+	xObjects[ 0 ].pvObject = xCommandQueue;
+	xObjects[ 1 ].eType = eWaitEventGroup;
+	xObjects[ 1 ].pvObject = xLinkEvents;
+	xObjects[ 1 ].ulBits = LINK_UP_BIT | LINK_DOWN_BIT;
+	xObjects[ 2 ].eType = eWaitNotification;
+	xObjects[ 2 ].ulBits = TX_DONE_BIT;
+
+	for( ;; )
+	{
+		switch( xTaskWaitForMultiple( xObjects, 3, portMAX_DELAY ) )
+		{
+			case 0:
+				if( xQueueReceive( xCommandQueue, &ulCommand, 0 ) == pdPASS )
+				{
+					// Process ulCommand.
+				}
+				break;
+
+			case 1:
+				// Handle xEventGroupClearBits( xLinkEvents, LINK_UP_BIT | LINK_DOWN_BIT ).
+				break;
+
+			case 2:
+				// Handle xTaskNotifyWait( 0, TX_DONE_BIT, NULL, 0 ).
+				break;
+		}
+	}
+ }
+ </pre>
+ * \defgroup xTaskWaitForMultiple xTaskWaitForMultiple
+ * \ingroup TaskNotifications
+ */
+BaseType_t xTaskWaitForMultiple( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
 /*-----------------------------------------------------------
  * SCHEDULER INTERNALS AVAILABLE FOR PORTING PURPOSES
@@ -2170,6 +2508,18 @@ void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, TickType_t xTi
 BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
 BaseType_t xTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem, const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
 
+// [ILG]
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * A version of xTaskRemoveFromUnorderedEventList() that can be called from an
+ * interrupt (or a critical section), used by the direct
+ * xEventGroupSetBitsFromISR().  If the scheduler is suspended the task is held
+ * in the pending ready list until it is resumed.
+ */
+BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem, const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
  * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
@@ -2215,16 +2565,27 @@ void vTaskMissedYield( void ) PRIVILEGED_FUNCTION;
 BaseType_t xTaskGetSchedulerState( void ) PRIVILEGED_FUNCTION;
 
 /*
- * Raises the priority of the mutex holder to that of the calling task should
- * the mutex holder have a priority less than the calling task.
+ * Called after the calling task has been placed on the list of tasks waiting
+ * for the mutex.  Raises the priority of the mutex holder to that of the
+ * calling task should the mutex holder have a priority less than the calling
+ * task, and if the holder is itself waiting for a mutex, propagates the raised
+ * priority along the chain of mutex holders.
  */
-void vTaskPriorityInherit( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
+void vTaskPriorityInherit( MutexLink_t * const pxMutexLink ) PRIVILEGED_FUNCTION;
 
 /*
- * Set the priority of a task back to its proper priority in the case that it
- * inherited a higher priority while it was holding a semaphore.
+ * Called when the mutex is given back.  Recomputes the priority of the holder
+ * from its base priority and the tasks waiting for the mutexes it still holds.
+ * Returns pdTRUE if the priority of the holder was lowered.
  */
-BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskPriorityDisinherit( MutexLink_t * const pxMutexLink ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when the calling task stopped waiting for the mutex without
+ * obtaining it.  The mutex holder, and the holders further up the chain, no
+ * longer inherit the priority of the calling task.
+ */
+void vTaskPriorityDisinheritAfterTimeout( MutexLink_t * const pxMutexLink ) PRIVILEGED_FUNCTION;
 
 /*
  * Get the uxTCBNumber assigned to the task referenced by the xTask parameter.
@@ -2264,10 +2625,79 @@ void vTaskStepTick( const TickType_t xTicksToJump ) PRIVILEGED_FUNCTION;
 eSleepModeStatus eTaskConfirmSleepModeStatus( void ) PRIVILEGED_FUNCTION;
 
 /*
- * For internal use only.  Increment the mutex held count when a mutex is
- * taken and return the handle of the task that has taken the mutex.
+ * For internal use only.  Increment the mutex held count and link the mutex
+ * to the calling task when a mutex is taken, and return the handle of the
+ * task that has taken the mutex.
+ */
+void *pvTaskIncrementMutexHeldCount( MutexLink_t * const pxMutexLink ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Link a mutex that was taken without the kernel to
+ * the task holding it, when another task has to wait for it.  Must be called
+ * from a critical section.
+ */
+void vTaskSetMutexHolder( MutexLink_t * const pxMutexLink, TaskHandle_t xHolder ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Recompute the priority of the task holding the
+ * mutex, if any, after the priority ceiling of the mutex changed.  Returns
+ * pdTRUE if a context switch is required.  Must be called from a critical
+ * section.
+ */
+BaseType_t xTaskUpdateMutexHolderPriority( MutexLink_t * const pxMutexLink ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Clear the link from the calling task to the mutex it
+ * was waiting for, when it takes a mutex without the kernel recording it as
+ * the holder.  Must be called from a critical section.
+ */
+void vTaskClearMutexWait( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Record the buffer into which a task that is about
+ * to block receiving from a queue wants the next item delivered, so a sender
+ * can copy the item straight into it.
+ */
+void vTaskSetHandoffBuffer( void * const pvBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Return and clear the buffer recorded by
+ * vTaskSetHandoffBuffer() for the task xTask, or for the calling task if xTask
+ * is NULL.  Must be called from a critical section.
+ */
+void *pvTaskTakeHandoffBuffer( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Record the event group waiter record of the calling
+ * task, which holds the bits it waits for when configUSE_FULL_EVENT_BITS is 1,
+ * or clear it by passing NULL.
+ */
+void vTaskSetEventWaiter( void * const pvWaiter ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Return the record set by vTaskSetEventWaiter() for
+ * the task xTask, or for the calling task if xTask is NULL.  Must be called
+ * from a critical section, or with the scheduler suspended.
+ */
+void *pvTaskGetEventWaiter( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  If the task xTask is blocked with a timeout that
+ * expires more than xTicksToWait ticks from now, make it expire xTicksToWait
+ * ticks from now instead.  Must be called from a critical section.  Returns
+ * pdFAIL, without doing anything, if the scheduler is suspended, as the
+ * delayed task lists may then be in use by the task that suspended it.
+ */
+BaseType_t xTaskAdvanceTimeout( TaskHandle_t xTask, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Wake the tasks blocked in xTaskWaitForMultiple()
+ * whose waiter records are linked in pxWaiterList, for a queue, or for an
+ * event group in which the bits ulBits were set.  Must be called from a
+ * critical section.  Returns pdTRUE if a woken task has a priority above that
+ * of the calling task.
  */
-void *pvTaskIncrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskWakeMultiWaiters( const List_t * const pxWaiterList, const uint32_t ulBits ) PRIVILEGED_FUNCTION;
 
 // [ILG]
 void vTaskPrepareSuspend( void );
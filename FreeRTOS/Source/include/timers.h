@@ -1298,12 +1298,165 @@ TickType_t xTimerGetPeriod( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
 */
 TickType_t xTimerGetExpiryTime( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
 
+// [ILG]
+/**
+ * BaseType_t xTimerStartDirect( TimerHandle_t xTimer );
+ * BaseType_t xTimerResetDirect( TimerHandle_t xTimer );
+ * BaseType_t xTimerStopDirect( TimerHandle_t xTimer );
+ * BaseType_t xTimerChangePeriodDirect( TimerHandle_t xTimer, TickType_t xNewPeriod );
+ *
+ * Versions of xTimerStart(), xTimerReset(), xTimerStop() and
+ * xTimerChangePeriod() that update the list of active timers directly, from
+ * a short critical section, instead of sending a command to the timer
+ * service/daemon task.  The change has taken effect when the function returns,
+ * and the timer service task only runs when a timer expires.
+ *
+ * While the scheduler is suspended, and just after the tick count overflowed,
+ * the timer service task cannot be made to wake up in time for a timer that
+ * would expire before any other without sending it a command.  Starting,
+ * resetting or changing the period of a timer then sends the command to the
+ * timer command queue instead, without blocking, and without updating the
+ * list of active timers first.
+ *
+ * The configUSE_TIMER_DIRECT_COMMANDS configuration constant must be set to 1
+ * for these functions to be available.
+ *
+ * @param xTimer The handle of the timer being started/restarted/stopped.
+ *
+ * @param xNewPeriod The new period for xTimer, in ticks.  As with
+ * xTimerChangePeriod(), the timer is started if it was not running.
+ *
+ * @return pdPASS, unless the command had to be sent to the timer command queue
+ * and the queue was full, in which case pdFAIL is returned and the timer is
+ * left as it was.
+ */
+#define xTimerStartDirect( xTimer ) xTimerGenericCommandDirect( ( xTimer ), tmrCOMMAND_START, 0U, NULL )
+#define xTimerResetDirect( xTimer ) xTimerGenericCommandDirect( ( xTimer ), tmrCOMMAND_RESET, 0U, NULL )
+#define xTimerStopDirect( xTimer ) xTimerGenericCommandDirect( ( xTimer ), tmrCOMMAND_STOP, 0U, NULL )
+#define xTimerChangePeriodDirect( xTimer, xNewPeriod ) xTimerGenericCommandDirect( ( xTimer ), tmrCOMMAND_CHANGE_PERIOD, ( xNewPeriod ), NULL )
+
+/**
+ * BaseType_t xTimerStartDirectFromISR( TimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken );
+ * BaseType_t xTimerResetDirectFromISR( TimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken );
+ * BaseType_t xTimerStopDirectFromISR( TimerHandle_t xTimer, BaseType_t *pxHigherPriorityTaskWoken );
+ * BaseType_t xTimerChangePeriodDirectFromISR( TimerHandle_t xTimer, TickType_t xNewPeriod, BaseType_t *pxHigherPriorityTaskWoken );
+ *
+ * Versions of xTimerStartDirect() and friends that can be called from an
+ * interrupt service routine.  *pxHigherPriorityTaskWoken is only set to pdTRUE
+ * if the command had to be sent to the timer command queue and that unblocked
+ * the timer service/daemon task.
+ */
+#define xTimerStartDirectFromISR( xTimer, pxHigherPriorityTaskWoken ) xTimerGenericCommandDirect( ( xTimer ), tmrCOMMAND_START_FROM_ISR, 0U, ( pxHigherPriorityTaskWoken ) )
+#define xTimerResetDirectFromISR( xTimer, pxHigherPriorityTaskWoken ) xTimerGenericCommandDirect( ( xTimer ), tmrCOMMAND_RESET_FROM_ISR, 0U, ( pxHigherPriorityTaskWoken ) )
+#define xTimerStopDirectFromISR( xTimer, pxHigherPriorityTaskWoken ) xTimerGenericCommandDirect( ( xTimer ), tmrCOMMAND_STOP_FROM_ISR, 0U, ( pxHigherPriorityTaskWoken ) )
+#define xTimerChangePeriodDirectFromISR( xTimer, xNewPeriod, pxHigherPriorityTaskWoken ) xTimerGenericCommandDirect( ( xTimer ), tmrCOMMAND_CHANGE_PERIOD_FROM_ISR, ( xNewPeriod ), ( pxHigherPriorityTaskWoken ) )
+
+// [ILG]
+/**
+ * void vTimerSetTickContext( TimerHandle_t xTimer, const UBaseType_t uxTickContext );
+ *
+ * Selects whether the callback of a timer is called from the tick interrupt,
+ * instead of from the timer service/daemon task.  Such a tick timer expires
+ * in the tick in which it is due, independently of the priority of the timer
+ * service task, of what other tasks run, and of the scheduler being suspended.
+ *
+ * The timer is started, stopped, reset and its period changed with the usual
+ * API functions, which then take effect immediately instead of sending a
+ * command to the timer service task.  Only deleting a tick timer still goes
+ * through the timer command queue.
+ *
+ * The callback runs inside the tick interrupt, with interrupts masked up to
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY.  It must be short, must not block, and
+ * must only call interrupt safe API functions (the ones that end in
+ * "FromISR"), including to start or stop timers.  If
+ * configTICK_TIMER_MAX_RUN_TIME is set above 0, configASSERT() is called when a
+ * callback runs for longer than that many run time stats counter units.
+ *
+ * The configUSE_TICK_TIMERS configuration constant must be set to 1 for this
+ * function to be available.
+ *
+ * @param xTimer The timer being updated.  It must be dormant.
+ *
+ * @param uxTickContext Set to pdTRUE for the callback to be called from the
+ * tick interrupt, or to pdFALSE for it to be called from the timer service
+ * task, which is the default.
+ */
+void vTimerSetTickContext( TimerHandle_t xTimer, const UBaseType_t uxTickContext ) PRIVILEGED_FUNCTION;
+
+// [ILG]
+/**
+ * void vTimerSetService( TimerHandle_t xTimer, const UBaseType_t uxService );
+ *
+ * Selects which timer service/daemon task handles a timer.  When
+ * configTIMER_SERVICE_COUNT is above 1 the kernel creates that many timer
+ * service tasks, each with its own list of active timers and its own timer
+ * command queue, running at the priorities listed in
+ * configTIMER_SERVICE_PRIORITIES.  A callback that takes a long time to run
+ * then only delays the timers of its own service, and timers with tight
+ * deadlines can be given a service task that runs above the tasks whose
+ * callbacks can be slow.
+ *
+ * Timers are created bound to service 0, which also runs the functions
+ * passed to xTimerPendFunctionCall() and xTimerPendFunctionCallFromISR(), and
+ * whose task handle is returned by xTimerGetTimerDaemonTaskHandle().
+ *
+ * If configSUPPORT_DYNAMIC_ALLOCATION is 0 the application must provide the
+ * memory of the extra service tasks by implementing
+ * vApplicationGetTimerServiceTaskMemory(), which is called with the index of
+ * the service (from 1) followed by the same parameters as
+ * vApplicationGetTimerTaskMemory().
+ *
+ * The configTIMER_SERVICE_COUNT configuration constant must be set above 1 for
+ * this function to be available.
+ *
+ * @param xTimer The timer being updated.  It must be dormant, which is the case
+ * from when it is created until it is first started.  In addition the timer
+ * service task it is bound to must have processed every command sent for the
+ * timer, for example by xTimerStop(), as these are not moved to the queue of
+ * the new service.  Both conditions are checked with configASSERT().
+ *
+ * @param uxService The index of the timer service task, from 0 to
+ * configTIMER_SERVICE_COUNT - 1.
+ */
+void vTimerSetService( TimerHandle_t xTimer, const UBaseType_t uxService ) PRIVILEGED_FUNCTION;
+
+// [ILG]
+/**
+ * void vTimerSetSlack( TimerHandle_t xTimer, const TickType_t xSlackInTicks );
+ *
+ * Allows the callback of a timer to be called up to xSlackInTicks ticks after
+ * the timer expires.  The timer service task then blocks until the latest time
+ * that respects the slack of all the timers that expire before it, and
+ * processes all the timers that expired up to then after a single wake up.
+ * Loosely timed timers, for example for periodic housekeeping, are so batched
+ * together, which reduces the number of context switches and, with
+ * configUSE_TICKLESS_IDLE, the number of times the processor leaves its low
+ * power mode.
+ *
+ * The slack only delays when the callback is called.  The expiry times of an
+ * auto reload timer remain a multiple of its period from when it was started,
+ * so the timer does not drift.  A timer with a slack of 0, which is the default,
+ * is processed in the tick in which it expires, as without slack.
+ *
+ * The configUSE_TIMER_SLACK configuration constant must be set to 1 for this
+ * function to be available.
+ *
+ * @param xTimer The timer being updated.  It must be dormant.
+ *
+ * @param xSlackInTicks The maximum number of ticks the callback can be called
+ * late.  It should be shorter than the period of the timer, and must be less
+ * than half of portMAX_DELAY.
+ */
+void vTimerSetSlack( TimerHandle_t xTimer, const TickType_t xSlackInTicks ) PRIVILEGED_FUNCTION;
+
 /*
  * Functions beyond this part are not part of the public API and are intended
  * for use by the kernel only.
  */
 BaseType_t xTimerCreateTimerTask( void ) PRIVILEGED_FUNCTION;
 BaseType_t xTimerGenericCommand( TimerHandle_t xTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue, BaseType_t * const pxHigherPriorityTaskWoken, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xTimerGenericCommandDirect( TimerHandle_t xTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION; // [ILG]
+void vTimerProcessTickTimers( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION; // [ILG]
 
 #ifdef __cplusplus
 }
@@ -69,6 +69,7 @@
 
 /* Standard includes. */
 #include <stdlib.h>
+#include <string.h>
 
 /* Scheduler includes. */
 #include "FreeRTOS.h"
@@ -135,6 +136,11 @@ does not have an FPU context, or any other value if the task does have an FPU
 context. */
 #define portNO_FLOATING_POINT_CONTEXT	( ( StackType_t ) 0 )
 
+/* The area reserved at the top of each task's stack to hold the FPU registers
+when configUSE_TASK_FPU_SUPPORT is 3.  This is 32 128-bit registers, plus the
+FPSR and FPCR, which keeps the stack 16 byte aligned. */
+#define portFPU_AREA_WORDS				( ( 32 * 2 ) + 2 )
+
 /* Constants required to setup the initial task context. */
 #define portEL3							( ( StackType_t ) 0x0c )
 #define portSP_ELx						( ( StackType_t ) 0x01 )
@@ -185,9 +191,26 @@ the scheduler starts.  As it is stored as part of the task context it will
 automatically be set to 0 when the first task is started. */
 volatile uint64_t ullCriticalNesting = 9999ULL;
 
-/* Saved as part of the task context.  If ullPortTaskHasFPUContext is non-zero
-then floating point context must be saved and restored for the task. */
-uint64_t ullPortTaskHasFPUContext = pdFALSE;
+#if( configUSE_TASK_FPU_SUPPORT == 3 )
+
+	/* Saved as part of the task context.  The address of the area at the top
+	of the task's stack into which its floating point registers are saved when
+	another task takes over the FPU. */
+	uint64_t ullPortTaskFPUArea = 0ULL;
+
+	/* The task whose floating point context is currently held in the FPU
+	registers (0 if none), and the area into which that context is saved. */
+	uint64_t ullPortFPUOwner = 0ULL;
+	uint64_t ullPortFPUOwnerArea = 0ULL;
+
+#else
+
+	/* Saved as part of the task context.  If ullPortTaskHasFPUContext is
+	non-zero then floating point context must be saved and restored for the
+	task. */
+	uint64_t ullPortTaskHasFPUContext = pdFALSE;
+
+#endif /* configUSE_TASK_FPU_SUPPORT */
 
 /* Set to 1 to pend a context switch from an ISR. */
 uint64_t ullPortYieldRequired = pdFALSE;
@@ -209,6 +232,17 @@ __attribute__(( used )) const uint64_t ullMaxAPIPriorityMask = ( configMAX_API_C
  */
 StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
 {
+#if( configUSE_TASK_FPU_SUPPORT == 3 )
+	StackType_t *pxFPUArea;
+
+	/* The floating point registers are saved lazily, outside of the context
+	frame, so reserve an area for them at the top of the stack, where it
+	remains for the life of the task.  The registers start at 0. */
+	pxTopOfStack -= portFPU_AREA_WORDS;
+	pxFPUArea = pxTopOfStack;
+	memset( pxFPUArea, 0x00, portFPU_AREA_WORDS * sizeof( StackType_t ) );
+#endif
+
 	/* Setup the initial stack of the task.  The stack is set exactly as
 	expected by the portRESTORE_CONTEXT() macro. */
 
@@ -290,10 +324,22 @@ StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t px
 	*pxTopOfStack = portNO_CRITICAL_NESTING;
 	pxTopOfStack--;
 
-	/* The task will start without a floating point context.  A task that uses
-	the floating point hardware must call vPortTaskUsesFPU() before executing
-	any floating point instructions. */
-	*pxTopOfStack = portNO_FLOATING_POINT_CONTEXT;
+	#if( configUSE_TASK_FPU_SUPPORT == 3 )
+	{
+		/* The task will start without its floating point context loaded.  The
+		context frame only holds the address of the area reserved above, the
+		registers are loaded from it when the task first executes a floating
+		point instruction. */
+		*pxTopOfStack = ( StackType_t ) pxFPUArea;
+	}
+	#else
+	{
+		/* The task will start without a floating point context.  A task that
+		uses the floating point hardware must call vPortTaskUsesFPU() before
+		executing any floating point instructions. */
+		*pxTopOfStack = portNO_FLOATING_POINT_CONTEXT;
+	}
+	#endif
 
 	return pxTopOfStack;
 }
@@ -459,15 +505,36 @@ void FreeRTOS_Tick_Handler( void )
 }
 /*-----------------------------------------------------------*/
 
-void vPortTaskUsesFPU( void )
-{
-	/* A task is registering the fact that it needs an FPU context.  Set the
-	FPU flag (which is saved as part of the task context). */
-	ullPortTaskHasFPUContext = pdTRUE;
+#if( configUSE_TASK_FPU_SUPPORT != 3 )
 
-	/* Consider initialising the FPSR here - but probably not necessary in
-	AArch64. */
-}
+	void vPortTaskUsesFPU( void )
+	{
+		/* A task is registering the fact that it needs an FPU context.  Set the
+		FPU flag (which is saved as part of the task context). */
+		ullPortTaskHasFPUContext = pdTRUE;
+
+		/* Consider initialising the FPSR here - but probably not necessary in
+		AArch64. */
+	}
+
+#else
+
+	void vPortCleanUpTCB( void *pxTCB )
+	{
+		/* The task is being deleted, so the area its floating point context
+		is saved in is about to be freed.  If the FPU registers still hold
+		that context then disown them, so they are not saved there later. */
+		portENTER_CRITICAL();
+		{
+			if( ullPortFPUOwner == ( uint64_t ) pxTCB )
+			{
+				ullPortFPUOwner = 0ULL;
+			}
+		}
+		portEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_TASK_FPU_SUPPORT */
 /*-----------------------------------------------------------*/
 
 void vPortClearInterruptMask( UBaseType_t uxNewMaskValue )
@@ -170,9 +170,37 @@ macros is used. */
 handler for whichever peripheral is used to generate the RTOS tick. */
 void FreeRTOS_Tick_Handler( void );
 
-/* Any task that uses the floating point unit MUST call vPortTaskUsesFPU()
-before any floating point instructions are executed. */
-void vPortTaskUsesFPU( void );
+/* Unless configUSE_TASK_FPU_SUPPORT is set to 3, any task that uses the
+floating point unit MUST call vPortTaskUsesFPU() before any floating point
+instructions are executed.
+
+If configUSE_TASK_FPU_SUPPORT is set to 3 then all tasks have an FPU context,
+switched lazily: floating point instructions are trapped (CPTR_EL3.TFP) when a
+task that does not own the FPU registers is switched in, and the registers are
+only saved and reloaded when that task executes its first floating point
+instruction.  The trap is handled by FreeRTOS_SWI_Handler.
+configUSE_TASK_FPU_SUPPORT must be defined to 3 when portASM.S is assembled too
+(for example with -DconfigUSE_TASK_FPU_SUPPORT=3).
+
+The FPU registers are only switched between tasks, so with
+configUSE_TASK_FPU_SUPPORT set to 3 the kernel, the port, any hook or trace
+macro it calls, and all interrupt handlers must be built without floating point
+or SIMD instructions (for example with -mgeneral-regs-only).
+vTaskSwitchContext() runs before the FPU is switched to the incoming task, and a
+floating point instruction executed in an interrupt handler stops in
+FreeRTOS_Abort. */
+#if( configUSE_TASK_FPU_SUPPORT != 3 )
+	void vPortTaskUsesFPU( void );
+#else
+	/* Each task has an FPU context already, so define this function away to
+	nothing to prevent it being called accidentally. */
+	#define vPortTaskUsesFPU()
+
+	/* A deleted task must give up the FPU registers, as the area they would be
+	saved to is freed with its stack. */
+	void vPortCleanUpTCB( void *pxTCB );
+	#define portCLEAN_UP_TCB( pxTCB ) vPortCleanUpTCB( pxTCB )
+#endif
 #define portTASK_USES_FLOATING_POINT() vPortTaskUsesFPU()
 
 #define portLOWEST_INTERRUPT_PRIORITY ( ( ( uint32_t ) configUNIQUE_INTERRUPT_PRIORITIES ) - 1UL )
@@ -193,6 +193,11 @@ debugger. */
 registers, plus a 32-bit status register. */
 #define portFPU_REGISTER_WORDS	( ( 32 * 2 ) + 1 )
 
+/* The area reserved at the top of each task's stack to hold the FPU registers
+when configUSE_TASK_FPU_SUPPORT is 3, rounded up to keep the stack 8 byte
+aligned. */
+#define portFPU_AREA_WORDS		( portFPU_REGISTER_WORDS + 1 )
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -236,13 +241,37 @@ the scheduler starts.  As it is stored as part of the task context it will
 automatically be set to 0 when the first task is started. */
 volatile uint32_t ulCriticalNesting = 9999UL;
 
-/* Saved as part of the task context.  If ulPortTaskHasFPUContext is non-zero then
-a floating point context must be saved and restored for the task. */
-volatile uint32_t ulPortTaskHasFPUContext = pdFALSE;
+#if( configUSE_TASK_FPU_SUPPORT == 3 )
+
+	/* Saved as part of the task context.  The address of the area at the top
+	of the task's stack into which its floating point registers are saved when
+	another task takes over the FPU. */
+	volatile uint32_t ulPortTaskFPUArea = 0UL;
+
+	/* The task whose floating point context is currently held in the FPU
+	registers (0 if none), and the area into which that context is saved. */
+	volatile uint32_t ulPortFPUOwner = 0UL;
+	volatile uint32_t ulPortFPUOwnerArea = 0UL;
+
+#else
+
+	/* Saved as part of the task context.  If ulPortTaskHasFPUContext is
+	non-zero then a floating point context must be saved and restored for the
+	task. */
+	volatile uint32_t ulPortTaskHasFPUContext = pdFALSE;
+
+#endif /* configUSE_TASK_FPU_SUPPORT */
 
 /* Set to 1 to pend a context switch from an ISR. */
 volatile uint32_t ulPortYieldRequired = pdFALSE;
 
+/* Critical sections do not write to the interrupt priority mask register, but
+only increment ulCriticalNesting, which FreeRTOS_IRQ_Handler checks before
+acknowledging an interrupt.  If an interrupt arrives while ulCriticalNesting is
+not zero the IRQ handler raises the priority mask, sets ulPortInterruptDeferred
+and returns, leaving the interrupt pending until the critical section exits. */
+volatile uint32_t ulPortInterruptDeferred = pdFALSE;
+
 /* Counts the interrupt nesting depth.  A context switch is only performed if
 if the nesting depth is 0. */
 volatile uint32_t ulPortInterruptNesting = 0UL;
@@ -260,6 +289,17 @@ __attribute__(( used )) const uint32_t ulMaxAPIPriorityMask = ( configMAX_API_CA
  */
 StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
 {
+#if( configUSE_TASK_FPU_SUPPORT == 3 )
+	StackType_t *pxFPUArea;
+
+	/* The floating point registers are saved lazily, outside of the context
+	frame, so reserve an area for them at the top of the stack, where it
+	remains for the life of the task.  The registers start at 0. */
+	pxTopOfStack -= portFPU_AREA_WORDS;
+	pxFPUArea = pxTopOfStack + 1;
+	memset( pxFPUArea, 0x00, portFPU_REGISTER_WORDS * sizeof( StackType_t ) );
+#endif
+
 	/* Setup the initial stack of the task.  The stack is set exactly as
 	expected by the portRESTORE_CONTEXT() macro.
 
@@ -339,9 +379,18 @@ StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t px
 		*pxTopOfStack = pdTRUE;
 		ulPortTaskHasFPUContext = pdTRUE;
 	}
+	#elif( configUSE_TASK_FPU_SUPPORT == 3 )
+	{
+		/* The task will start without its floating point context loaded.  The
+		context frame only holds the address of the area reserved above, the
+		registers are loaded from it by FreeRTOS_Undefined_Handler() when the
+		task first executes a floating point instruction. */
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) pxFPUArea;
+	}
 	#else
 	{
-		#error Invalid configUSE_TASK_FPU_SUPPORT setting - configUSE_TASK_FPU_SUPPORT must be set to 1, 2, or left undefined.
+		#error Invalid configUSE_TASK_FPU_SUPPORT setting - configUSE_TASK_FPU_SUPPORT must be set to 1, 2, 3, or left undefined.
 	}
 	#endif
 	
@@ -451,13 +500,15 @@ void vPortEndScheduler( void )
 
 void vPortEnterCritical( void )
 {
-	/* Mask interrupts up to the max syscall interrupt priority. */
-	ulPortSetInterruptMask();
-
-	/* Now interrupts are disabled ulCriticalNesting can be accessed
-	directly.  Increment ulCriticalNesting to keep a count of how many times
-	portENTER_CRITICAL() has been called. */
+	/* Interrupts up to the max syscall interrupt priority are masked as soon
+	as ulCriticalNesting is not zero (see ulPortInterruptDeferred), so
+	incrementing it is all that is needed.  It is part of the task context, so
+	it is still correct if an interrupt switches context during the
+	increment.  ulCriticalNesting being volatile only orders it against other
+	volatile accesses, so a compiler barrier stops the accesses made inside
+	the critical section from being moved above the increment. */
 	ulCriticalNesting++;
+	__asm volatile( "" ::: "memory" );
 
 	/* This is not the interrupt safe version of the enter critical function so
 	assert() if it is being called from an interrupt context.  Only API
@@ -476,16 +527,21 @@ void vPortExitCritical( void )
 	if( ulCriticalNesting > portNO_CRITICAL_NESTING )
 	{
 		/* Decrement the nesting count as the critical section is being
-		exited. */
+		exited, after all the accesses made inside it. */
+		__asm volatile( "" ::: "memory" );
 		ulCriticalNesting--;
 
-		/* If the nesting level has reached zero then all interrupt
-		priorities must be re-enabled. */
+		/* If the nesting level has reached zero, and an interrupt was
+		deferred while in the critical section, then the priority mask was
+		raised to hold that interrupt pending.  Unmask all interrupt priorities
+		again so it is taken now. */
 		if( ulCriticalNesting == portNO_CRITICAL_NESTING )
 		{
-			/* Critical nesting has reached zero so all interrupt priorities
-			should be unmasked. */
-			portCLEAR_INTERRUPT_MASK();
+			if( ulPortInterruptDeferred != pdFALSE )
+			{
+				ulPortInterruptDeferred = pdFALSE;
+				portCLEAR_INTERRUPT_MASK();
+			}
 		}
 	}
 }
@@ -516,7 +572,7 @@ void FreeRTOS_Tick_Handler( void )
 }
 /*-----------------------------------------------------------*/
 
-#if( configUSE_TASK_FPU_SUPPORT != 2 )
+#if( ( configUSE_TASK_FPU_SUPPORT != 2 ) && ( configUSE_TASK_FPU_SUPPORT != 3 ) )
 
 	void vPortTaskUsesFPU( void )
 	{
@@ -533,6 +589,26 @@ void FreeRTOS_Tick_Handler( void )
 #endif /* configUSE_TASK_FPU_SUPPORT */
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TASK_FPU_SUPPORT == 3 )
+
+	void vPortCleanUpTCB( void *pxTCB )
+	{
+		/* The task is being deleted, so the area its floating point context
+		is saved in is about to be freed.  If the FPU registers still hold
+		that context then disown them, so they are not saved there later. */
+		portENTER_CRITICAL();
+		{
+			if( ulPortFPUOwner == ( uint32_t ) pxTCB )
+			{
+				ulPortFPUOwner = 0UL;
+			}
+		}
+		portEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_TASK_FPU_SUPPORT */
+/*-----------------------------------------------------------*/
+
 void vPortClearInterruptMask( uint32_t ulNewMaskValue )
 {
 	if( ulNewMaskValue == pdFALSE )
@@ -165,14 +165,39 @@ void FreeRTOS_Tick_Handler( void );
 created without an FPU context and must call vPortTaskUsesFPU() to give
 themselves an FPU context before using any FPU instructions.  If
 configUSE_TASK_FPU_SUPPORT is set to 2 then all tasks will have an FPU context
-by default. */
-#if( configUSE_TASK_FPU_SUPPORT != 2 )
+by default.
+
+If configUSE_TASK_FPU_SUPPORT is set to 3 then all tasks also have an FPU
+context, but it is switched lazily: the FPU is disabled when a task that does
+not own the FPU registers is switched in, and the registers are only saved and
+reloaded when that task executes its first floating point instruction.  This
+requires FreeRTOS_Undefined_Handler() to be installed as the undefined
+instruction handler, an undefined instruction mode stack, and
+configUSE_TASK_FPU_SUPPORT to be defined to 3 when portASM.S is assembled too
+(for example with -DconfigUSE_TASK_FPU_SUPPORT=3).
+
+The FPU registers are only switched between tasks, so with
+configUSE_TASK_FPU_SUPPORT set to 3 the kernel, the port, any hook or trace
+macro it calls, and every interrupt handler other than
+vApplicationFPUSafeIRQHandler() must be built without floating point
+instructions (for example with -mgeneral-regs-only).  vTaskSwitchContext() runs
+before the FPU is switched to the incoming task, and a floating point
+instruction executed in an interrupt handler stops in
+FreeRTOS_Undefined_Handler(). */
+#if( ( configUSE_TASK_FPU_SUPPORT != 2 ) && ( configUSE_TASK_FPU_SUPPORT != 3 ) )
 	void vPortTaskUsesFPU( void );
 #else
 	/* Each task has an FPU context already, so define this function away to
 	nothing to prevent it being called accidentally. */
 	#define vPortTaskUsesFPU()
 #endif
+
+#if( configUSE_TASK_FPU_SUPPORT == 3 )
+	/* A deleted task must give up the FPU registers, as the area they would be
+	saved to is freed with its stack. */
+	void vPortCleanUpTCB( void *pxTCB );
+	#define portCLEAN_UP_TCB( pxTCB ) vPortCleanUpTCB( pxTCB )
+#endif
 #define portTASK_USES_FLOATING_POINT() vPortTaskUsesFPU()
 
 #define portLOWEST_INTERRUPT_PRIORITY ( ( ( uint32_t ) configUNIQUE_INTERRUPT_PRIORITIES ) - 1UL )
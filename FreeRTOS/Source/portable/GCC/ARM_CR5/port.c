@@ -218,6 +218,13 @@ uint32_t ulPortTaskHasFPUContext = pdFALSE;
 /* Set to 1 to pend a context switch from an ISR. */
 uint32_t ulPortYieldRequired = pdFALSE;
 
+/* Critical sections do not write to the interrupt priority mask register, but
+only increment ulCriticalNesting, which FreeRTOS_IRQ_Handler checks before
+acknowledging an interrupt.  If an interrupt arrives while ulCriticalNesting is
+not zero the IRQ handler raises the priority mask, sets ulPortInterruptDeferred
+and returns, leaving the interrupt pending until the critical section exits. */
+volatile uint32_t ulPortInterruptDeferred = pdFALSE;
+
 /* Counts the interrupt nesting depth.  A context switch is only performed if
 if the nesting depth is 0. */
 uint32_t ulPortInterruptNesting = 0UL;
@@ -414,13 +421,15 @@ void vPortEndScheduler( void )
 
 void vPortEnterCritical( void )
 {
-	/* Mask interrupts up to the max syscall interrupt priority. */
-	ulPortSetInterruptMask();
-
-	/* Now interrupts are disabled ulCriticalNesting can be accessed
-	directly.  Increment ulCriticalNesting to keep a count of how many times
-	portENTER_CRITICAL() has been called. */
+	/* Interrupts up to the max syscall interrupt priority are masked as soon
+	as ulCriticalNesting is not zero (see ulPortInterruptDeferred), so
+	incrementing it is all that is needed.  It is part of the task context, so
+	it is still correct if an interrupt switches context during the
+	increment.  ulCriticalNesting being volatile only orders it against other
+	volatile accesses, so a compiler barrier stops the accesses made inside
+	the critical section from being moved above the increment. */
 	ulCriticalNesting++;
+	__asm volatile( "" ::: "memory" );
 
 	/* This is not the interrupt safe version of the enter critical function so
 	assert() if it is being called from an interrupt context.  Only API
@@ -439,16 +448,21 @@ void vPortExitCritical( void )
 	if( ulCriticalNesting > portNO_CRITICAL_NESTING )
 	{
 		/* Decrement the nesting count as the critical section is being
-		exited. */
+		exited, after all the accesses made inside it. */
+		__asm volatile( "" ::: "memory" );
 		ulCriticalNesting--;
 
-		/* If the nesting level has reached zero then all interrupt
-		priorities must be re-enabled. */
+		/* If the nesting level has reached zero, and an interrupt was
+		deferred while in the critical section, then the priority mask was
+		raised to hold that interrupt pending.  Unmask all interrupt priorities
+		again so it is taken now. */
 		if( ulCriticalNesting == portNO_CRITICAL_NESTING )
 		{
-			/* Critical nesting has reached zero so all interrupt priorities
-			should be unmasked. */
-			portCLEAR_INTERRUPT_MASK();
+			if( ulPortInterruptDeferred != pdFALSE )
+			{
+				ulPortInterruptDeferred = pdFALSE;
+				portCLEAR_INTERRUPT_MASK();
+			}
 		}
 	}
 }
@@ -94,6 +94,11 @@ privileged Vs unprivileged linkage and placement. */
 #define queueUNLOCKED					( ( int8_t ) -1 )
 #define queueLOCKED_UNMODIFIED			( ( int8_t ) 0 )
 
+/* Adds a number of items moved while the queue was locked to a lock count,
+saturating at the largest value the int8_t count can hold. */
+#define prvAddToLockCount( cLock, uxCount ) \
+	( ( ( ( UBaseType_t ) ( cLock ) + ( uxCount ) ) > ( UBaseType_t ) 127 ) ? ( ( int8_t ) 127 ) : ( ( int8_t ) ( ( UBaseType_t ) ( cLock ) + ( uxCount ) ) ) ) // [ILG]
+
 /* When the Queue_t structure is used to represent a base queue its pcHead and
 pcTail members are used as pointers into the queue storage area.  When the
 Queue_t structure is used to represent a mutex pcHead and pcTail pointers are
@@ -122,6 +127,12 @@ zero. */
 	#define queueYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
 #endif
 
+// [ILG]
+/* Bits of ucZeroCopyState, set while a slot of the queue storage area is lent
+out by pvQueueReserveSlot() or pvQueueAcquireSlot(). */
+#define queueSLOT_RESERVED				( ( uint8_t ) 0x01U )
+#define queueSLOT_ACQUIRED				( ( uint8_t ) 0x02U )
+
 // [ILG]
 #if defined ( __GNUC__ )
 #pragma GCC diagnostic push
@@ -159,6 +170,11 @@ typedef struct QueueDefinition
 		uint8_t ucStaticallyAllocated;	/*< Set to pdTRUE if the memory used by the queue was statically allocated to ensure no attempt is made to free the memory. */
 	#endif
 
+	// [ILG]
+	#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+		uint8_t ucZeroCopyState;	/*< Set of queueSLOT_RESERVED and queueSLOT_ACQUIRED bits, recording a slot of the storage area lent out by pvQueueReserveSlot() or pvQueueAcquireSlot(). */
+	#endif
+
 	#if ( configUSE_QUEUE_SETS == 1 )
 		struct QueueDefinition *pxQueueSetContainer;
 	#endif
@@ -168,6 +184,15 @@ typedef struct QueueDefinition
 		uint8_t ucQueueType;
 	#endif
 
+	#if ( configUSE_MUTEXES == 1 )
+		MutexLink_t xMutexLink;		/*< Links the mutex to its holder and to its waiting tasks when the structure is used as a mutex, to implement transitive priority inheritance. */
+	#endif
+
+	// [ILG]
+	#if ( configUSE_MULTI_WAIT == 1 )
+		List_t xMultiWaiters;		/*< The waiter records of tasks blocked in xTaskWaitForMultiple() until the queue is not empty.  Not ordered. */
+	#endif
+
 } xQUEUE;
 
 // [ILG]
@@ -179,6 +204,77 @@ typedef struct QueueDefinition
 name below to enable the use of older kernel aware debuggers. */
 typedef xQUEUE Queue_t;
 
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+	/* The owner word of a fast mutex holds the handle of the holding task, or
+	queueFAST_MUTEX_AVAILABLE.  Task handles are at least word aligned, so the
+	low bit is used to flag that tasks are waiting, which forces the holder
+	through the kernel when giving the mutex back. */
+	#define queueFAST_MUTEX_AVAILABLE	( ( portPOINTER_SIZE_TYPE ) 0U )
+	#define queueFAST_MUTEX_WAITERS		( ( portPOINTER_SIZE_TYPE ) 1U )
+
+	/* Use the exclusive load/store instructions (LDREX/STREX, or LDXR/STXR on
+	AArch64) for the compare and swap when the architecture has them.
+	Exception entry clears the exclusive monitor, so a sequence interrupted by
+	a context switch simply retries.  Otherwise interrupts are masked around
+	the compare and swap. */
+	#if defined( __GNUC__ ) && ( defined( __ARM_ARCH_7M__ ) || defined( __ARM_ARCH_7EM__ ) || defined( __ARM_ARCH_7A__ ) || defined( __ARM_ARCH_7R__ ) || defined( __aarch64__ ) )
+		#define queueFAST_MUTEX_USE_EXCLUSIVES	1
+	#else
+		#define queueFAST_MUTEX_USE_EXCLUSIVES	0
+	#endif
+
+	/*
+	 * Definition of the fast mutex.  It is not a queue, all the state needed
+	 * by the uncontended paths is in the owner word.
+	 */
+	typedef struct xFAST_MUTEX
+	{
+		volatile portPOINTER_SIZE_TYPE uxOwner;	/*< The handle of the holding task, possibly with queueFAST_MUTEX_WAITERS set. */
+		List_t xTasksWaitingToTake;				/*< List of tasks that are blocked waiting to take the mutex.  Stored in priority order. */
+		MutexLink_t xMutexLink;					/*< Links the mutex to its holder while tasks are waiting, for priority inheritance. */
+
+		#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+			uint8_t ucStaticallyAllocated;		/*< Set to pdTRUE if the memory used by the mutex was statically allocated to ensure no attempt is made to free the memory. */
+		#endif
+	} FastMutex_t;
+
+#endif /* configUSE_FAST_MUTEXES */
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+	/* Order the accesses to the storage area and to the indices of an SPSC
+	queue.  The producer and the consumer run on the same core, so this only
+	has to stop the compiler and the core from reordering them. */
+	#if defined( __GNUC__ )
+		#define queueSPSC_MEMORY_BARRIER()	__atomic_thread_fence( __ATOMIC_SEQ_CST )
+	#else
+		#error SPSC queues need a memory barrier definition for this compiler
+	#endif
+
+	/*
+	 * Definition of the single producer, single consumer queue.  The producer
+	 * only writes uxWriteIndex and the consumer only writes uxReadIndex, so
+	 * neither side needs a critical section.  The indices run from 0 to
+	 * ( 2 * uxLength ) - 1, so a full queue can be told apart from an empty
+	 * one without leaving a slot unused.
+	 */
+	typedef struct xSPSC_QUEUE
+	{
+		int8_t *pcHead;							/*< Points to the beginning of the queue storage area. */
+		UBaseType_t uxLength;					/*< The number of items the queue can hold. */
+		UBaseType_t uxItemSize;					/*< The size of each item. */
+		volatile UBaseType_t uxWriteIndex;		/*< The index of the next item to write, only changed by the producer. */
+		volatile UBaseType_t uxReadIndex;		/*< The index of the next item to read, only changed by the consumer. */
+		TaskHandle_t volatile xWaitingTask;		/*< The consumer task while it is about to block or blocked on the empty queue, otherwise NULL. */
+
+		#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+			uint8_t ucStaticallyAllocated;		/*< Set to pdTRUE if the memory used by the queue was statically allocated to ensure no attempt is made to free the memory. */
+		#endif
+	} SpscQueue_t;
+
+#endif /* configUSE_SPSC_QUEUES */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -243,6 +339,68 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvIte
  */
 static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copies up to the first uxItemCount items into the back of the queue, or out
+ * of the front of the queue, using at most two memcpy() calls - one for the
+ * run of slots up to the end of the storage area and one for the run that
+ * wraps back to its start.  The caller ensures there is enough space (or
+ * data) for all uxItemCount items.
+ */
+static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const int8_t *pcItems, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION; // [ILG]
+static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, int8_t *pcBuffer, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION; // [ILG]
+
+/*
+ * Removes up to uxItemCount tasks from the event list pxEventList, one for
+ * each item that was moved into or out of the queue.  Must be called from a
+ * critical section with the queue unlocked.
+ *
+ * @return pdTRUE if a removed task has a priority above that of the calling
+ * task, otherwise pdFALSE.
+ */
+static BaseType_t prvUnblockMultipleWaiters( List_t * const pxEventList, UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION; // [ILG]
+
+#if ( configUSE_MULTI_WAIT == 1 )
+	/*
+	 * Called after data has been posted to a queue, to wake the tasks blocked
+	 * in xTaskWaitForMultiple() on the queue.  Must be called from a critical
+	 * section, and not while the queue is locked.  Returns pdTRUE if a woken
+	 * task has a priority above the calling task.
+	 */
+	static BaseType_t prvNotifyMultiWaiters( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION; // [ILG]
+#endif
+
+#if ( configUSE_QUEUE_SETS == 1 )
+	/*
+	 * Posts the queue handle to the queue set the queue is a member of once
+	 * for each of uxItemCount items sent to the queue.
+	 */
+	static BaseType_t prvNotifyQueueSetContainerMultiple( const Queue_t * const pxQueue, UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION; // [ILG]
+#endif
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+	/*
+	 * Blocks the calling task until there is space in the queue (if
+	 * xWaitingToSend is pdTRUE) or data in the queue (if xWaitingToSend is
+	 * pdFALSE), or until the timeout expires, in which case *pxTicksToWait is
+	 * set to 0.  Called outside a critical section.
+	 */
+	static void prvWaitOnQueue( Queue_t * const pxQueue, const BaseType_t xWaitingToSend, TimeOut_t * const pxTimeOut, TickType_t * const pxTicksToWait ) PRIVILEGED_FUNCTION; // [ILG]
+#endif
+
+#if ( configUSE_QUEUE_HANDOFF == 1 )
+	/*
+	 * If the queue is empty and the highest priority task waiting to receive
+	 * from it has recorded a buffer for the item, copies the item straight
+	 * into that buffer and unblocks the task, bypassing the storage area.
+	 * Must be called from a critical section with the queue unlocked.
+	 *
+	 * @return pdTRUE if the item was handed off, otherwise pdFALSE.
+	 * *pxYieldRequired is set to pdTRUE if the unblocked task has a priority
+	 * above that of the calling task.
+	 */
+	static BaseType_t prvHandOffToReceiver( Queue_t * const pxQueue, const void * const pvItemToQueue, BaseType_t * const pxYieldRequired ) PRIVILEGED_FUNCTION; // [ILG]
+#endif
+
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
@@ -266,6 +424,50 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 	static void prvInitialiseMutex( Queue_t *pxNewQueue ) PRIVILEGED_FUNCTION;
 #endif
 
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+	/*
+	 * Atomically replace the owner word of a fast mutex if it holds the
+	 * expected value.  Returns pdTRUE if the owner word was replaced.
+	 */
+	static BaseType_t prvFastMutexCompareAndSwap( FastMutex_t * const pxMutex, portPOINTER_SIZE_TYPE uxExpected, const portPOINTER_SIZE_TYPE uxDesired ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called after a fast mutex has been allocated either statically or
+	 * dynamically to fill in the structure's members.
+	 */
+	static void prvInitialiseFastMutex( FastMutex_t *pxNewMutex ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * The contended paths of xQueueTakeFastMutex() and xQueueGiveFastMutex(),
+	 * using the wait list and priority inheritance.
+	 */
+	static BaseType_t prvTakeFastMutexContended( FastMutex_t * const pxMutex, const portPOINTER_SIZE_TYPE uxSelf, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+	static BaseType_t prvGiveFastMutexContended( FastMutex_t * const pxMutex, const portPOINTER_SIZE_TYPE uxSelf ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_FAST_MUTEXES */
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+	/*
+	 * Called after an SPSC queue has been allocated either statically or
+	 * dynamically to fill in the structure's members.
+	 */
+	static void prvInitialiseSpscQueue( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, SpscQueue_t *pxNewQueue ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * The number of items in an SPSC queue given a pair of its indices.
+	 */
+	static UBaseType_t prvSpscMessagesWaiting( const SpscQueue_t * const pxQueue, const UBaseType_t uxWriteIndex, const UBaseType_t uxReadIndex ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Advances an SPSC queue index, and returns the storage offset of the slot
+	 * the index referred to.
+	 */
+	static UBaseType_t prvSpscAdvanceIndex( const SpscQueue_t * const pxQueue, UBaseType_t * const puxIndex ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_SPSC_QUEUES */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -302,6 +504,13 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		pxQueue->cRxLock = queueUNLOCKED;
 		pxQueue->cTxLock = queueUNLOCKED;
 
+		// [ILG]
+		#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+		{
+			pxQueue->ucZeroCopyState = 0U;
+		}
+		#endif
+
 		if( xNewQueue == pdFALSE )
 		{
 			/* If there are tasks blocked waiting to read from the queue, then
@@ -330,6 +539,13 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			/* Ensure the event queues start in the correct state. */
 			vListInitialise( &( pxQueue->xTasksWaitingToSend ) );
 			vListInitialise( &( pxQueue->xTasksWaitingToReceive ) );
+
+			// [ILG]
+			#if ( configUSE_MULTI_WAIT == 1 )
+			{
+				vListInitialise( &( pxQueue->xMultiWaiters ) );
+			}
+			#endif
 		}
 	}
 	taskEXIT_CRITICAL();
@@ -495,6 +711,10 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 			pxNewQueue->pxMutexHolder = NULL;
 			pxNewQueue->uxQueueType = queueQUEUE_IS_MUTEX;
 
+			vListInitialiseItem( &( pxNewQueue->xMutexLink.xHeldListItem ) );
+			pxNewQueue->xMutexLink.pxWaitingTasks = &( pxNewQueue->xTasksWaitingToReceive );
+			pxNewQueue->xMutexLink.uxCeiling = tskIDLE_PRIORITY;
+
 			/* In case this is a recursive mutex. */
 			pxNewQueue->u.uxRecursiveCallCount = 0;
 
@@ -578,6 +798,63 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 #endif
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MUTEXES == 1 )
+
+	void vQueueSetMutexPriorityCeiling( QueueHandle_t xMutex, UBaseType_t uxCeiling )
+	{
+	Queue_t * const pxMutex = ( Queue_t * ) xMutex;
+
+		configASSERT( pxMutex );
+		configASSERT( pxMutex->uxQueueType == queueQUEUE_IS_MUTEX );
+		configASSERT( uxCeiling < ( UBaseType_t ) configMAX_PRIORITIES );
+
+		/* Ensure the new ceiling is valid. */
+		if( uxCeiling >= ( UBaseType_t ) configMAX_PRIORITIES )
+		{
+			uxCeiling = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		taskENTER_CRITICAL();
+		{
+			pxMutex->xMutexLink.uxCeiling = uxCeiling;
+
+			/* If the mutex is currently held then the holder is raised to, or
+			lowered from, the ceiling straight away, so a raised ceiling also
+			protects the critical section in progress. */
+			if( xTaskUpdateMutexHolderPriority( &( pxMutex->xMutexLink ) ) != pdFALSE )
+			{
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	UBaseType_t uxQueueGetMutexPriorityCeiling( QueueHandle_t xMutex )
+	{
+	Queue_t * const pxMutex = ( Queue_t * ) xMutex;
+
+		configASSERT( pxMutex );
+		configASSERT( pxMutex->uxQueueType == queueQUEUE_IS_MUTEX );
+
+		return pxMutex->xMutexLink.uxCeiling;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_RECURSIVE_MUTEXES == 1 )
 
 	BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex )
@@ -675,329 +952,1847 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 #endif /* configUSE_RECURSIVE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+#if ( configUSE_FAST_MUTEXES == 1 )
 
-	QueueHandle_t xQueueCreateCountingSemaphoreStatic( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, StaticQueue_t *pxStaticQueue )
+	static BaseType_t prvFastMutexCompareAndSwap( FastMutex_t * const pxMutex, portPOINTER_SIZE_TYPE uxExpected, const portPOINTER_SIZE_TYPE uxDesired )
 	{
-	QueueHandle_t xHandle;
+	BaseType_t xReturn;
 
-		configASSERT( uxMaxCount != 0 );
-		configASSERT( uxInitialCount <= uxMaxCount );
+		#if( queueFAST_MUTEX_USE_EXCLUSIVES == 1 )
+		{
+			xReturn = ( BaseType_t ) __atomic_compare_exchange_n( &( pxMutex->uxOwner ), &uxExpected, uxDesired, pdFALSE, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED );
+		}
+		#else
+		{
+		UBaseType_t uxSavedInterruptStatus;
 
-		xHandle = xQueueGenericCreateStatic( uxMaxCount, queueSEMAPHORE_QUEUE_ITEM_LENGTH, NULL, pxStaticQueue, queueQUEUE_TYPE_COUNTING_SEMAPHORE );
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			{
+				if( pxMutex->uxOwner == uxExpected )
+				{
+					pxMutex->uxOwner = uxDesired;
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					xReturn = pdFALSE;
+				}
+			}
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		#endif
 
-		if( xHandle != NULL )
+		return xReturn;
+	}
+
+#endif /* configUSE_FAST_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+	static void prvInitialiseFastMutex( FastMutex_t *pxNewMutex )
+	{
+		pxNewMutex->uxOwner = queueFAST_MUTEX_AVAILABLE;
+		vListInitialise( &( pxNewMutex->xTasksWaitingToTake ) );
+
+		vListInitialiseItem( &( pxNewMutex->xMutexLink.xHeldListItem ) );
+		pxNewMutex->xMutexLink.pxWaitingTasks = &( pxNewMutex->xTasksWaitingToTake );
+		pxNewMutex->xMutexLink.uxCeiling = tskIDLE_PRIORITY;
+	}
+
+#endif /* configUSE_FAST_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_FAST_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	FastMutexHandle_t xQueueCreateFastMutex( void )
+	{
+	FastMutex_t *pxNewMutex;
+
+		pxNewMutex = ( FastMutex_t * ) pvPortMalloc( sizeof( FastMutex_t ) );
+
+		if( pxNewMutex != NULL )
 		{
-			( ( Queue_t * ) xHandle )->uxMessagesWaiting = uxInitialCount;
+			prvInitialiseFastMutex( pxNewMutex );
 
-			traceCREATE_COUNTING_SEMAPHORE();
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				/* Both static and dynamic allocation can be used, so note this
+				mutex was allocated dynamically in case it is later deleted. */
+				pxNewMutex->ucStaticallyAllocated = pdFALSE;
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
 		}
 		else
 		{
-			traceCREATE_COUNTING_SEMAPHORE_FAILED();
+			traceQUEUE_CREATE_FAILED( queueQUEUE_TYPE_MUTEX );
 		}
 
-		return xHandle;
+		return ( FastMutexHandle_t ) pxNewMutex;
 	}
 
-#endif /* ( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+#endif /* configUSE_FAST_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+#if( ( configUSE_FAST_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
 
-	QueueHandle_t xQueueCreateCountingSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount )
+	FastMutexHandle_t xQueueCreateFastMutexStatic( StaticFastMutex_t *pxStaticMutex )
 	{
-	QueueHandle_t xHandle;
+	FastMutex_t *pxNewMutex;
 
-		configASSERT( uxMaxCount != 0 );
-		configASSERT( uxInitialCount <= uxMaxCount );
+		configASSERT( pxStaticMutex );
 
-		xHandle = xQueueGenericCreate( uxMaxCount, queueSEMAPHORE_QUEUE_ITEM_LENGTH, queueQUEUE_TYPE_COUNTING_SEMAPHORE );
+		#if( configASSERT_DEFINED == 1 )
+		{
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticFastMutex_t equals the size of the real
+			mutex structure. */
+			volatile size_t xSize = sizeof( StaticFastMutex_t );
+			configASSERT( xSize == sizeof( FastMutex_t ) );
+		}
+		#endif /* configASSERT_DEFINED */
 
-		if( xHandle != NULL )
+		/* The address of a statically allocated mutex was passed in, use it. */
+		pxNewMutex = ( FastMutex_t * ) pxStaticMutex; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+		if( pxNewMutex != NULL )
 		{
-			( ( Queue_t * ) xHandle )->uxMessagesWaiting = uxInitialCount;
+			prvInitialiseFastMutex( pxNewMutex );
 
-			traceCREATE_COUNTING_SEMAPHORE();
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				/* Both static and dynamic allocation can be used, so note this
+				mutex was allocated statically in case it is later deleted. */
+				pxNewMutex->ucStaticallyAllocated = pdTRUE;
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+		}
+
+		return ( FastMutexHandle_t ) pxNewMutex;
+	}
+
+#endif /* configUSE_FAST_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+	void vQueueDeleteFastMutex( FastMutexHandle_t xMutex )
+	{
+	FastMutex_t * const pxMutex = ( FastMutex_t * ) xMutex;
+
+		configASSERT( pxMutex );
+
+		/* Do not delete a mutex that is held or waited for. */
+		configASSERT( pxMutex->uxOwner == queueFAST_MUTEX_AVAILABLE );
+
+		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+		{
+			/* The mutex can only have been allocated dynamically - free it
+			again. */
+			vPortFree( pxMutex );
+		}
+		#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+		{
+			/* The mutex could have been allocated statically or dynamically, so
+			check before attempting to free the memory. */
+			if( pxMutex->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+			{
+				vPortFree( pxMutex );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			/* The mutex must have been statically allocated, so is not going to
+			be deleted.  Avoid compiler warnings about the unused parameter. */
+			( void ) pxMutex;
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+	}
+
+#endif /* configUSE_FAST_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+	BaseType_t xQueueTakeFastMutex( FastMutexHandle_t xMutex, TickType_t xTicksToWait )
+	{
+	FastMutex_t * const pxMutex = ( FastMutex_t * ) xMutex;
+	const portPOINTER_SIZE_TYPE uxSelf = ( portPOINTER_SIZE_TYPE ) xTaskGetCurrentTaskHandle();
+	BaseType_t xReturn;
+
+		configASSERT( pxMutex );
+		configASSERT( ( uxSelf & queueFAST_MUTEX_WAITERS ) == 0 );
+
+		/* Uncontended case - a single compare and swap, no critical section
+		and no list access. */
+		if( prvFastMutexCompareAndSwap( pxMutex, queueFAST_MUTEX_AVAILABLE, uxSelf ) != pdFALSE )
+		{
+			xReturn = pdPASS;
 		}
 		else
 		{
-			traceCREATE_COUNTING_SEMAPHORE_FAILED();
+			xReturn = prvTakeFastMutexContended( pxMutex, uxSelf, xTicksToWait );
 		}
 
-		return xHandle;
+		return xReturn;
 	}
 
-#endif /* ( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+#endif /* configUSE_FAST_MUTEXES */
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueueGenericSend( QueueHandle_t xQueue, const void * const pvItemToQueue, TickType_t xTicksToWait, const BaseType_t xCopyPosition )
-{
-BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
-TimeOut_t xTimeOut;
-Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+#if ( configUSE_FAST_MUTEXES == 1 )
 
-	configASSERT( pxQueue );
-	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-	configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
-	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	BaseType_t xQueueGiveFastMutex( FastMutexHandle_t xMutex )
 	{
-		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	FastMutex_t * const pxMutex = ( FastMutex_t * ) xMutex;
+	const portPOINTER_SIZE_TYPE uxSelf = ( portPOINTER_SIZE_TYPE ) xTaskGetCurrentTaskHandle();
+	BaseType_t xReturn;
+
+		configASSERT( pxMutex );
+
+		/* Uncontended case - the owner word only holds the calling task, so
+		nobody has to be woken and no priority was inherited. */
+		if( prvFastMutexCompareAndSwap( pxMutex, uxSelf, queueFAST_MUTEX_AVAILABLE ) != pdFALSE )
+		{
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = prvGiveFastMutexContended( pxMutex, uxSelf );
+		}
+
+		return xReturn;
 	}
-	#endif
 
+#endif /* configUSE_FAST_MUTEXES */
+/*-----------------------------------------------------------*/
 
-	/* This function relaxes the coding standard somewhat to allow return
-	statements within the function itself.  This is done in the interest
-	of execution time efficiency. */
-	for( ;; )
+#if ( configUSE_FAST_MUTEXES == 1 )
+
+	static BaseType_t prvTakeFastMutexContended( FastMutex_t * const pxMutex, const portPOINTER_SIZE_TYPE uxSelf, TickType_t xTicksToWait )
 	{
-		taskENTER_CRITICAL();
+	BaseType_t xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
+	portPOINTER_SIZE_TYPE uxOwner;
+
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 		{
-			/* Is there room on the queue now?  The running task must be the
-			highest priority task wanting to access the queue.  If the head item
-			in the queue is to be overwritten then it does not matter if the
-			queue is full. */
-			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
 			{
-				traceQUEUE_SEND( pxQueue );
-				xYieldRequired = prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+				uxOwner = pxMutex->uxOwner;
 
-				#if ( configUSE_QUEUE_SETS == 1 )
+				/* The mutex is available if no task holds it, although tasks
+				may still be waiting for it. */
+				if( ( uxOwner & ~queueFAST_MUTEX_WAITERS ) == queueFAST_MUTEX_AVAILABLE )
 				{
-					if( pxQueue->pxQueueSetContainer != NULL )
+					if( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToTake ) ) == pdFALSE )
 					{
-						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) != pdFALSE )
-						{
-							/* The queue is a member of a queue set, and posting
-							to the queue set caused a higher priority task to
-							unblock. A context switch is required. */
-							queueYIELD_IF_USING_PREEMPTION();
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+						/* Keep the holder on the slow path so the waiting tasks
+						are woken, and inherit their priority. */
+						pxMutex->uxOwner = uxSelf | queueFAST_MUTEX_WAITERS;
+						( void ) pvTaskIncrementMutexHeldCount( &( pxMutex->xMutexLink ) );
 					}
 					else
 					{
-						/* If there was a task waiting for data to arrive on the
-						queue then unblock it now. */
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
-						{
-							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
-							{
-								/* The unblocked task has a priority higher than
-								our own so yield immediately.  Yes it is ok to
-								do this from within the critical section - the
-								kernel takes care of that. */
-								queueYIELD_IF_USING_PREEMPTION();
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
-						}
-						else if( xYieldRequired != pdFALSE )
-						{
-							/* This path is a special case that will only get
-							executed if the task was holding multiple mutexes
-							and the mutexes were given back in an order that is
-							different to that in which they were taken. */
-							queueYIELD_IF_USING_PREEMPTION();
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+						pxMutex->uxOwner = uxSelf;
 					}
+
+					/* The calling task might have blocked on the mutex before
+					obtaining it. */
+					vTaskClearMutexWait();
+
+					taskEXIT_CRITICAL();
+					return pdPASS;
 				}
-				#else /* configUSE_QUEUE_SETS */
+				else if( xTicksToWait == ( TickType_t ) 0 )
 				{
-					/* If there was a task waiting for data to arrive on the
-					queue then unblock it now. */
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					/* The mutex is held and no block time is specified (or the
+					block time has expired) so leave now. */
+					taskEXIT_CRITICAL();
+					return errQUEUE_EMPTY;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					/* The mutex is held and a block time was specified so
+					configure the timeout structure. */
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The mutex was taken with a compare and swap, so it is not yet
+				known to the holder.  Flag the owner word so the holder gives
+				the mutex back through the kernel, and link the mutex to the
+				holder so it can inherit the priority of the waiting tasks. */
+				if( ( uxOwner & queueFAST_MUTEX_WAITERS ) == 0 )
+				{
+					pxMutex->uxOwner = uxOwner | queueFAST_MUTEX_WAITERS;
+					vTaskSetMutexHolder( &( pxMutex->xMutexLink ), ( TaskHandle_t ) uxOwner );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			/* The holder cannot run, and so cannot give the mutex, while the
+			scheduler is suspended.  Mutexes cannot be given from interrupts. */
+			vTaskSuspendAll();
+
+			/* Update the timeout state to see if it has expired yet. */
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				if( ( pxMutex->uxOwner & ~queueFAST_MUTEX_WAITERS ) != queueFAST_MUTEX_AVAILABLE )
+				{
+					vTaskPlaceOnEventList( &( pxMutex->xTasksWaitingToTake ), xTicksToWait );
+
+					/* The calling task is now in the list of waiting tasks, from
+					where the holders along the chain of mutexes inherit its
+					priority. */
+					taskENTER_CRITICAL();
 					{
-						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
-						{
-							/* The unblocked task has a priority higher than
-							our own so yield immediately.  Yes it is ok to do
-							this from within the critical section - the kernel
-							takes care of that. */
-							queueYIELD_IF_USING_PREEMPTION();
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+						vTaskPriorityInherit( &( pxMutex->xMutexLink ) );
 					}
-					else if( xYieldRequired != pdFALSE )
+					taskEXIT_CRITICAL();
+
+					if( xTaskResumeAll() == pdFALSE )
 					{
-						/* This path is a special case that will only get
-						executed if the task was holding multiple mutexes and
-						the mutexes were given back in an order that is
-						different to that in which they were taken. */
-						queueYIELD_IF_USING_PREEMPTION();
+						portYIELD_WITHIN_API();
 					}
 					else
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
 				}
-				#endif /* configUSE_QUEUE_SETS */
-
-				taskEXIT_CRITICAL();
-				return pdPASS;
+				else
+				{
+					/* Try again. */
+					( void ) xTaskResumeAll();
+				}
 			}
 			else
 			{
-				if( xTicksToWait == ( TickType_t ) 0 )
-				{
-					/* The queue was full and no block time is specified (or
-					the block time has expired) so leave now. */
-					taskEXIT_CRITICAL();
+				( void ) xTaskResumeAll();
 
-					/* Return to the original privilege level before exiting
-					the function. */
-					traceQUEUE_SEND_FAILED( pxQueue );
-					return errQUEUE_FULL;
+				taskENTER_CRITICAL();
+				{
+					/* The holders along the chain of mutexes no longer inherit
+					the priority of the calling task. */
+					vTaskPriorityDisinheritAfterTimeout( &( pxMutex->xMutexLink ) );
 				}
-				else if( xEntryTimeSet == pdFALSE )
+				taskEXIT_CRITICAL();
+
+				if( ( pxMutex->uxOwner & ~queueFAST_MUTEX_WAITERS ) != queueFAST_MUTEX_AVAILABLE )
 				{
-					/* The queue was full and a block time was specified so
-					configure the timeout structure. */
-					vTaskSetTimeOutState( &xTimeOut );
-					xEntryTimeSet = pdTRUE;
+					return errQUEUE_EMPTY;
 				}
 				else
 				{
-					/* Entry time was already set. */
+					/* Take it with the zero block time. */
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
 		}
-		taskEXIT_CRITICAL();
+	}
 
-		/* Interrupts and other tasks can send to and receive from the queue
-		now the critical section has been exited. */
+#endif /* configUSE_FAST_MUTEXES */
+/*-----------------------------------------------------------*/
 
-		vTaskSuspendAll();
-		prvLockQueue( pxQueue );
+#if ( configUSE_FAST_MUTEXES == 1 )
 
-		/* Update the timeout state to see if it has expired yet. */
-		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+	static BaseType_t prvGiveFastMutexContended( FastMutex_t * const pxMutex, const portPOINTER_SIZE_TYPE uxSelf )
+	{
+	BaseType_t xReturn, xYieldRequired = pdFALSE;
+
+		taskENTER_CRITICAL();
 		{
-			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			/* Only the holder can give the mutex. */
+			if( ( pxMutex->uxOwner & ~queueFAST_MUTEX_WAITERS ) == uxSelf )
 			{
-				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
-				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+				/* While tasks are still waiting the waiters flag remains set
+				without a holder, so the next task to take the mutex goes
+				through the slow path and inherits their priority. */
+				if( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToTake ) ) == pdFALSE )
+				{
+					pxMutex->uxOwner = queueFAST_MUTEX_WAITERS;
+				}
+				else
+				{
+					pxMutex->uxOwner = queueFAST_MUTEX_AVAILABLE;
+				}
 
-				/* Unlocking the queue means queue events can effect the
-				event list.  It is possible	that interrupts occurring now
-				remove this task from the event	list again - but as the
-				scheduler is suspended the task will go onto the pending
-				ready last instead of the actual ready list. */
-				prvUnlockQueue( pxQueue );
+				/* The mutex was linked to the calling task when the waiters
+				flag was set. */
+				xYieldRequired = xTaskPriorityDisinherit( &( pxMutex->xMutexLink ) );
 
-				/* Resuming the scheduler will move tasks from the pending
-				ready list into the ready list - so it is feasible that this
-				task is already in a ready list before it yields - in which
-				case the yield will not cause a context switch unless there
-				is also a higher priority task in the pending ready list. */
-				if( xTaskResumeAll() == pdFALSE )
+				if( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToTake ) ) == pdFALSE )
 				{
-					portYIELD_WITHIN_API();
+					if( xTaskRemoveFromEventList( &( pxMutex->xTasksWaitingToTake ) ) != pdFALSE )
+					{
+						xYieldRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xYieldRequired != pdFALSE )
+				{
+					queueYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
 				}
+
+				xReturn = pdPASS;
 			}
 			else
 			{
-				/* Try again. */
-				prvUnlockQueue( pxQueue );
-				( void ) xTaskResumeAll();
+				/* The mutex cannot be given because the calling task is not
+				the holder. */
+				xReturn = pdFAIL;
 			}
 		}
-		else
-		{
-			/* The timeout has expired. */
-			prvUnlockQueue( pxQueue );
-			( void ) xTaskResumeAll();
+		taskEXIT_CRITICAL();
 
-			traceQUEUE_SEND_FAILED( pxQueue );
-			return errQUEUE_FULL;
-		}
+		return xReturn;
 	}
-	// [ILG]
-  return pdFAIL;
-}
+
+#endif /* configUSE_FAST_MUTEXES */
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue, const void * const pvItemToQueue, BaseType_t * const pxHigherPriorityTaskWoken, const BaseType_t xCopyPosition )
-{
-BaseType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
-Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+#if ( configUSE_FAST_MUTEXES == 1 )
 
-	configASSERT( pxQueue );
-	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-	configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
+	void* xQueueGetFastMutexHolder( FastMutexHandle_t xMutex )
+	{
+		return ( void * ) ( ( ( FastMutex_t * ) xMutex )->uxOwner & ~queueFAST_MUTEX_WAITERS );
+	}
 
-	/* RTOS ports that support interrupt nesting have the concept of a maximum
-	system call (or maximum API call) interrupt priority.  Interrupts that are
-	above the maximum system call priority are kept permanently enabled, even
-	when the RTOS kernel is in a critical section, but cannot make any calls to
-	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-	failure if a FreeRTOS API function is called from an interrupt that has been
-	assigned a priority above the configured maximum system call priority.
-	Only FreeRTOS functions that end in FromISR can be called from interrupts
-	that have been assigned a priority at or (logically) below the maximum
-	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
-	safe API to ensure interrupt entry is as fast and as simple as possible.
-	More information (albeit Cortex-M specific) is provided on the following
-	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
-	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+#endif /* configUSE_FAST_MUTEXES */
+/*-----------------------------------------------------------*/
 
-	/* Similar to xQueueGenericSend, except without blocking if there is no room
-	in the queue.  Also don't directly wake a task that was blocked on a queue
-	read, instead return a flag to say whether a context switch is required or
-	not (i.e. has a task with a higher priority than us been woken by this
-	post). */
-	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+	static void prvInitialiseSpscQueue( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, SpscQueue_t *pxNewQueue )
 	{
-		if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
-		{
-			const int8_t cTxLock = pxQueue->cTxLock;
+		pxNewQueue->pcHead = ( int8_t * ) pucQueueStorage;
+		pxNewQueue->uxLength = uxQueueLength;
+		pxNewQueue->uxItemSize = uxItemSize;
+		pxNewQueue->uxWriteIndex = ( UBaseType_t ) 0U;
+		pxNewQueue->uxReadIndex = ( UBaseType_t ) 0U;
+		pxNewQueue->xWaitingTask = NULL;
+	}
 
-			traceQUEUE_SEND_FROM_ISR( pxQueue );
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
 
-			/* Semaphores use xQueueGiveFromISR(), so pxQueue will not be a
-			semaphore or mutex.  That means prvCopyDataToQueue() cannot result
-			in a task disinheriting a priority and prvCopyDataToQueue() can be
-			called here even though the disinherit function does not check if
-			the scheduler is suspended before accessing the ready lists. */
-			( void ) prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+#if ( configUSE_SPSC_QUEUES == 1 )
 
-			/* The event list is not altered if the queue is locked.  This will
-			be done when the queue is unlocked later. */
-			if( cTxLock == queueUNLOCKED )
+	static UBaseType_t prvSpscMessagesWaiting( const SpscQueue_t * const pxQueue, const UBaseType_t uxWriteIndex, const UBaseType_t uxReadIndex )
+	{
+	UBaseType_t uxReturn;
+
+		if( uxWriteIndex >= uxReadIndex )
+		{
+			uxReturn = uxWriteIndex - uxReadIndex;
+		}
+		else
+		{
+			uxReturn = ( uxWriteIndex + ( 2U * pxQueue->uxLength ) ) - uxReadIndex;
+		}
+
+		return uxReturn;
+	}
+
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+	static UBaseType_t prvSpscAdvanceIndex( const SpscQueue_t * const pxQueue, UBaseType_t * const puxIndex )
+	{
+	UBaseType_t uxIndex = *puxIndex, uxSlot;
+
+		if( uxIndex < pxQueue->uxLength )
+		{
+			uxSlot = uxIndex;
+		}
+		else
+		{
+			uxSlot = uxIndex - pxQueue->uxLength;
+		}
+
+		++uxIndex;
+		if( uxIndex >= ( 2U * pxQueue->uxLength ) )
+		{
+			uxIndex = ( UBaseType_t ) 0U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		*puxIndex = uxIndex;
+
+		return uxSlot * pxQueue->uxItemSize;
+	}
+
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_SPSC_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	SpscQueueHandle_t xQueueCreateSpsc( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize )
+	{
+	SpscQueue_t *pxNewQueue;
+	uint8_t *pucQueueStorage;
+
+		configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+		configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+		/* Allocate the queue and its storage area in one block, as
+		xQueueGenericCreate() does. */
+		pxNewQueue = ( SpscQueue_t * ) pvPortMalloc( sizeof( SpscQueue_t ) + ( size_t ) ( uxQueueLength * uxItemSize ) );
+
+		if( pxNewQueue != NULL )
+		{
+			pucQueueStorage = ( ( uint8_t * ) pxNewQueue ) + sizeof( SpscQueue_t );
+			prvInitialiseSpscQueue( uxQueueLength, uxItemSize, pucQueueStorage, pxNewQueue );
+
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				/* Both static and dynamic allocation can be used, so note this
+				queue was allocated dynamically in case it is later deleted. */
+				pxNewQueue->ucStaticallyAllocated = pdFALSE;
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+		}
+		else
+		{
+			traceQUEUE_CREATE_FAILED( queueQUEUE_TYPE_BASE );
+		}
+
+		return ( SpscQueueHandle_t ) pxNewQueue;
+	}
+
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_SPSC_QUEUES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	SpscQueueHandle_t xQueueCreateSpscStatic( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, StaticSpscQueue_t *pxStaticQueue )
+	{
+	SpscQueue_t *pxNewQueue;
+
+		configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+		configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+		configASSERT( pucQueueStorage );
+		configASSERT( pxStaticQueue );
+
+		#if( configASSERT_DEFINED == 1 )
+		{
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticSpscQueue_t equals the size of the real
+			queue structure. */
+			volatile size_t xSize = sizeof( StaticSpscQueue_t );
+			configASSERT( xSize == sizeof( SpscQueue_t ) );
+		}
+		#endif /* configASSERT_DEFINED */
+
+		/* The address of a statically allocated queue was passed in, use it. */
+		pxNewQueue = ( SpscQueue_t * ) pxStaticQueue; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+		if( pxNewQueue != NULL )
+		{
+			prvInitialiseSpscQueue( uxQueueLength, uxItemSize, pucQueueStorage, pxNewQueue );
+
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				/* Both static and dynamic allocation can be used, so note this
+				queue was allocated statically in case it is later deleted. */
+				pxNewQueue->ucStaticallyAllocated = pdTRUE;
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+		}
+
+		return ( SpscQueueHandle_t ) pxNewQueue;
+	}
+
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+	void vQueueDeleteSpsc( SpscQueueHandle_t xQueue )
+	{
+	SpscQueue_t * const pxQueue = ( SpscQueue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+
+		/* Do not delete a queue the consumer is waiting on. */
+		configASSERT( pxQueue->xWaitingTask == NULL );
+
+		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+		{
+			/* The queue can only have been allocated dynamically - free it
+			again. */
+			vPortFree( pxQueue );
+		}
+		#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+		{
+			/* The queue could have been allocated statically or dynamically, so
+			check before attempting to free the memory. */
+			if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+			{
+				vPortFree( pxQueue );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			/* The queue must have been statically allocated, so is not going to
+			be deleted.  Avoid compiler warnings about the unused parameter. */
+			( void ) pxQueue;
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+	}
+
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+	BaseType_t xQueueSendSpscFromISR( SpscQueueHandle_t xQueue, const void * const pvItemToQueue, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	SpscQueue_t * const pxQueue = ( SpscQueue_t * ) xQueue;
+	UBaseType_t uxWriteIndex, uxOffset;
+	TaskHandle_t xWaitingTask;
+
+		configASSERT( pxQueue );
+		configASSERT( pvItemToQueue );
+
+		/* Unlike xQueueSendFromISR() this does not mask interrupts: only this
+		function writes uxWriteIndex, and uxReadIndex is read once. */
+		uxWriteIndex = pxQueue->uxWriteIndex;
+
+		if( prvSpscMessagesWaiting( pxQueue, uxWriteIndex, pxQueue->uxReadIndex ) >= pxQueue->uxLength )
+		{
+			return errQUEUE_FULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		uxOffset = prvSpscAdvanceIndex( pxQueue, &uxWriteIndex );
+		( void ) memcpy( ( void * ) ( pxQueue->pcHead + uxOffset ), pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+		/* Publish the item only once it has been written, then look for a
+		waiting consumer only once the item has been published.  The consumer
+		does the opposite, so either it sees the item or this sees it. */
+		queueSPSC_MEMORY_BARRIER();
+		pxQueue->uxWriteIndex = uxWriteIndex;
+		queueSPSC_MEMORY_BARRIER();
+
+		/* The kernel is only involved when the consumer is waiting. */
+		xWaitingTask = pxQueue->xWaitingTask;
+		if( xWaitingTask != NULL )
+		{
+			pxQueue->xWaitingTask = NULL;
+			vTaskNotifyGiveFromISR( xWaitingTask, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pdPASS;
+	}
+
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+	BaseType_t xQueueSendSpsc( SpscQueueHandle_t xQueue, const void * const pvItemToQueue )
+	{
+	BaseType_t xReturn, xHigherPriorityTaskWoken = pdFALSE;
+
+		xReturn = xQueueSendSpscFromISR( xQueue, pvItemToQueue, &xHigherPriorityTaskWoken );
+
+		if( xHigherPriorityTaskWoken != pdFALSE )
+		{
+			queueYIELD_IF_USING_PREEMPTION();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+	BaseType_t xQueueReceiveSpsc( SpscQueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait )
+	{
+	SpscQueue_t * const pxQueue = ( SpscQueue_t * ) xQueue;
+	BaseType_t xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
+	UBaseType_t uxReadIndex, uxOffset;
+
+		configASSERT( pxQueue );
+		configASSERT( pvBuffer );
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		for( ;; )
+		{
+			uxReadIndex = pxQueue->uxReadIndex;
+
+			if( pxQueue->uxWriteIndex != uxReadIndex )
+			{
+				/* Read the item only once it has been seen published, and
+				release its slot only once it has been read. */
+				queueSPSC_MEMORY_BARRIER();
+				uxOffset = prvSpscAdvanceIndex( pxQueue, &uxReadIndex );
+				( void ) memcpy( pvBuffer, ( void * ) ( pxQueue->pcHead + uxOffset ), ( size_t ) pxQueue->uxItemSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				queueSPSC_MEMORY_BARRIER();
+				pxQueue->uxReadIndex = uxReadIndex;
+
+				return pdPASS;
+			}
+			else if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				return errQUEUE_EMPTY;
+			}
+			else if( xEntryTimeSet == pdFALSE )
+			{
+				vTaskSetTimeOutState( &xTimeOut );
+				xEntryTimeSet = pdTRUE;
+			}
+			else
+			{
+				/* Entry time was already set. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Announce the intention to block, then look at the queue again
+			before blocking, so an item published in between is not missed.
+			A notification from the producer is latched by the kernel, so it
+			is not lost if it arrives before ulTaskNotifyTake() is called. */
+			pxQueue->xWaitingTask = xTaskGetCurrentTaskHandle();
+			queueSPSC_MEMORY_BARRIER();
+
+			if( pxQueue->uxWriteIndex == pxQueue->uxReadIndex )
+			{
+				if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+				{
+					( void ) ulTaskNotifyTake( pdTRUE, xTicksToWait );
+				}
+				else
+				{
+					/* The timeout has expired, so have one last look at the
+					queue without blocking. */
+					xTicksToWait = ( TickType_t ) 0;
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxQueue->xWaitingTask = NULL;
+		}
+	}
+
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+	UBaseType_t uxQueueSpscMessagesWaiting( const SpscQueueHandle_t xQueue )
+	{
+	const SpscQueue_t * const pxQueue = ( const SpscQueue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+
+		return prvSpscMessagesWaiting( pxQueue, pxQueue->uxWriteIndex, pxQueue->uxReadIndex );
+	}
+
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCountingSemaphoreStatic( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, StaticQueue_t *pxStaticQueue )
+	{
+	QueueHandle_t xHandle;
+
+		configASSERT( uxMaxCount != 0 );
+		configASSERT( uxInitialCount <= uxMaxCount );
+
+		xHandle = xQueueGenericCreateStatic( uxMaxCount, queueSEMAPHORE_QUEUE_ITEM_LENGTH, NULL, pxStaticQueue, queueQUEUE_TYPE_COUNTING_SEMAPHORE );
+
+		if( xHandle != NULL )
+		{
+			( ( Queue_t * ) xHandle )->uxMessagesWaiting = uxInitialCount;
+
+			traceCREATE_COUNTING_SEMAPHORE();
+		}
+		else
+		{
+			traceCREATE_COUNTING_SEMAPHORE_FAILED();
+		}
+
+		return xHandle;
+	}
+
+#endif /* ( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCountingSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount )
+	{
+	QueueHandle_t xHandle;
+
+		configASSERT( uxMaxCount != 0 );
+		configASSERT( uxInitialCount <= uxMaxCount );
+
+		xHandle = xQueueGenericCreate( uxMaxCount, queueSEMAPHORE_QUEUE_ITEM_LENGTH, queueQUEUE_TYPE_COUNTING_SEMAPHORE );
+
+		if( xHandle != NULL )
+		{
+			( ( Queue_t * ) xHandle )->uxMessagesWaiting = uxInitialCount;
+
+			traceCREATE_COUNTING_SEMAPHORE();
+		}
+		else
+		{
+			traceCREATE_COUNTING_SEMAPHORE_FAILED();
+		}
+
+		return xHandle;
+	}
+
+#endif /* ( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configUSE_COUNTING_SEMAPHORES == 1 )
+
+	BaseType_t xQueueResetSemaphoreCount( QueueHandle_t xSemaphore, const UBaseType_t uxCount )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xSemaphore;
+	BaseType_t xReturn;
+
+		configASSERT( pxQueue );
+		configASSERT( pxQueue->uxItemSize == ( UBaseType_t ) 0 );
+		configASSERT( uxCount <= pxQueue->uxLength );
+
+		taskENTER_CRITICAL();
+		{
+			/* Tasks blocked taking the semaphore would have to be unblocked
+			by the new count, so the count is only reset while there are
+			none. */
+			xReturn = listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) );
+
+			#if ( configUSE_MULTI_WAIT == 1 )
+			{
+				if( listLIST_IS_EMPTY( &( pxQueue->xMultiWaiters ) ) == pdFALSE )
+				{
+					xReturn = pdFALSE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
+			if( xReturn != pdFALSE )
+			{
+				pxQueue->uxMessagesWaiting = uxCount;
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_COUNTING_SEMAPHORES */
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueGenericSend( QueueHandle_t xQueue, const void * const pvItemToQueue, TickType_t xTicksToWait, const BaseType_t xCopyPosition )
+{
+BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
+TimeOut_t xTimeOut;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+
+	/* This function relaxes the coding standard somewhat to allow return
+	statements within the function itself.  This is done in the interest
+	of execution time efficiency. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			/* Is there room on the queue now?  The running task must be the
+			highest priority task wanting to access the queue.  If the head item
+			in the queue is to be overwritten then it does not matter if the
+			queue is full. */
+			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+			{
+				traceQUEUE_SEND( pxQueue );
+
+				// [ILG]
+				#if ( configUSE_QUEUE_HANDOFF == 1 )
+				{
+					/* A task already waiting for the item gets it directly,
+					without it passing through the storage area. */
+					if( prvHandOffToReceiver( pxQueue, pvItemToQueue, &xYieldRequired ) != pdFALSE )
+					{
+						if( xYieldRequired != pdFALSE )
+						{
+							queueYIELD_IF_USING_PREEMPTION();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						taskEXIT_CRITICAL();
+						return pdPASS;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_QUEUE_HANDOFF */
+
+				xYieldRequired = prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+
+				#if ( configUSE_QUEUE_SETS == 1 )
+				{
+					if( pxQueue->pxQueueSetContainer != NULL )
+					{
+						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) != pdFALSE )
+						{
+							/* The queue is a member of a queue set, and posting
+							to the queue set caused a higher priority task to
+							unblock. A context switch is required. */
+							queueYIELD_IF_USING_PREEMPTION();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						/* If there was a task waiting for data to arrive on the
+						queue then unblock it now. */
+						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						{
+							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+							{
+								/* The unblocked task has a priority higher than
+								our own so yield immediately.  Yes it is ok to
+								do this from within the critical section - the
+								kernel takes care of that. */
+								queueYIELD_IF_USING_PREEMPTION();
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else if( xYieldRequired != pdFALSE )
+						{
+							/* This path is a special case that will only get
+							executed if the task was holding multiple mutexes
+							and the mutexes were given back in an order that is
+							different to that in which they were taken. */
+							queueYIELD_IF_USING_PREEMPTION();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+				}
+				#else /* configUSE_QUEUE_SETS */
+				{
+					/* If there was a task waiting for data to arrive on the
+					queue then unblock it now. */
+					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					{
+						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+						{
+							/* The unblocked task has a priority higher than
+							our own so yield immediately.  Yes it is ok to do
+							this from within the critical section - the kernel
+							takes care of that. */
+							queueYIELD_IF_USING_PREEMPTION();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else if( xYieldRequired != pdFALSE )
+					{
+						/* This path is a special case that will only get
+						executed if the task was holding multiple mutexes and
+						the mutexes were given back in an order that is
+						different to that in which they were taken. */
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_QUEUE_SETS */
+
+				// [ILG]
+				#if ( configUSE_MULTI_WAIT == 1 )
+				{
+					if( prvNotifyMultiWaiters( pxQueue ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
+				taskEXIT_CRITICAL();
+				return pdPASS;
+			}
+			else
+			{
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					/* The queue was full and no block time is specified (or
+					the block time has expired) so leave now. */
+					taskEXIT_CRITICAL();
+
+					/* Return to the original privilege level before exiting
+					the function. */
+					traceQUEUE_SEND_FAILED( pxQueue );
+					return errQUEUE_FULL;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					/* The queue was full and a block time was specified so
+					configure the timeout structure. */
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* Interrupts and other tasks can send to and receive from the queue
+		now the critical section has been exited. */
+
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+
+				/* Unlocking the queue means queue events can effect the
+				event list.  It is possible	that interrupts occurring now
+				remove this task from the event	list again - but as the
+				scheduler is suspended the task will go onto the pending
+				ready last instead of the actual ready list. */
+				prvUnlockQueue( pxQueue );
+
+				/* Resuming the scheduler will move tasks from the pending
+				ready list into the ready list - so it is feasible that this
+				task is already in a ready list before it yields - in which
+				case the yield will not cause a context switch unless there
+				is also a higher priority task in the pending ready list. */
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+			}
+			else
+			{
+				/* Try again. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			/* The timeout has expired. */
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			traceQUEUE_SEND_FAILED( pxQueue );
+			return errQUEUE_FULL;
+		}
+	}
+	// [ILG]
+  return pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue, const void * const pvItemToQueue, BaseType_t * const pxHigherPriorityTaskWoken, const BaseType_t xCopyPosition )
+{
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  Interrupts that are
+	above the maximum system call priority are kept permanently enabled, even
+	when the RTOS kernel is in a critical section, but cannot make any calls to
+	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+	failure if a FreeRTOS API function is called from an interrupt that has been
+	assigned a priority above the configured maximum system call priority.
+	Only FreeRTOS functions that end in FromISR can be called from interrupts
+	that have been assigned a priority at or (logically) below the maximum
+	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+	safe API to ensure interrupt entry is as fast and as simple as possible.
+	More information (albeit Cortex-M specific) is provided on the following
+	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	/* Similar to xQueueGenericSend, except without blocking if there is no room
+	in the queue.  Also don't directly wake a task that was blocked on a queue
+	read, instead return a flag to say whether a context switch is required or
+	not (i.e. has a task with a higher priority than us been woken by this
+	post). */
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		// [ILG]
+		#if ( configUSE_QUEUE_HANDOFF == 1 )
+		BaseType_t xYieldRequired = pdFALSE;
+
+		/* The event list is not altered if the queue is locked, so the item
+		can only be handed off to a waiting task if it is not. */
+		if( ( pxQueue->cTxLock == queueUNLOCKED ) && ( prvHandOffToReceiver( pxQueue, pvItemToQueue, &xYieldRequired ) != pdFALSE ) )
+		{
+			traceQUEUE_SEND_FROM_ISR( pxQueue );
+
+			if( ( xYieldRequired != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+			{
+				*pxHigherPriorityTaskWoken = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			xReturn = pdPASS;
+		}
+		else
+		#endif /* configUSE_QUEUE_HANDOFF */
+		if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+		{
+			const int8_t cTxLock = pxQueue->cTxLock;
+
+			traceQUEUE_SEND_FROM_ISR( pxQueue );
+
+			/* Semaphores use xQueueGiveFromISR(), so pxQueue will not be a
+			semaphore or mutex.  That means prvCopyDataToQueue() cannot result
+			in a task disinheriting a priority and prvCopyDataToQueue() can be
+			called here even though the disinherit function does not check if
+			the scheduler is suspended before accessing the ready lists. */
+			( void ) prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+
+			/* The event list is not altered if the queue is locked.  This will
+			be done when the queue is unlocked later. */
+			if( cTxLock == queueUNLOCKED )
+			{
+				#if ( configUSE_QUEUE_SETS == 1 )
+				{
+					if( pxQueue->pxQueueSetContainer != NULL )
+					{
+						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) != pdFALSE )
+						{
+							/* The queue is a member of a queue set, and posting
+							to the queue set caused a higher priority task to
+							unblock.  A context switch is required. */
+							if( pxHigherPriorityTaskWoken != NULL )
+							{
+								*pxHigherPriorityTaskWoken = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						{
+							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+							{
+								/* The task waiting has a higher priority so
+								record that a context switch is required. */
+								if( pxHigherPriorityTaskWoken != NULL )
+								{
+									*pxHigherPriorityTaskWoken = pdTRUE;
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+				}
+				#else /* configUSE_QUEUE_SETS */
+				{
+					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					{
+						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+						{
+							/* The task waiting has a higher priority so record that a
+							context	switch is required. */
+							if( pxHigherPriorityTaskWoken != NULL )
+							{
+								*pxHigherPriorityTaskWoken = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_QUEUE_SETS */
+
+				// [ILG]
+				#if ( configUSE_MULTI_WAIT == 1 )
+				{
+					if( ( prvNotifyMultiWaiters( pxQueue ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+			}
+			else
+			{
+				/* Increment the lock count so the task that unlocks the queue
+				knows that data was posted while it was locked. */
+				pxQueue->cTxLock = ( int8_t ) ( cTxLock + 1 );
+			}
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+			xReturn = errQUEUE_FULL;
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	/* Similar to xQueueGenericSendFromISR() but used with semaphores where the
+	item size is 0.  Don't directly wake a task that was blocked on a queue
+	read, instead return a flag to say whether a context switch is required or
+	not (i.e. has a task with a higher priority than us been woken by this
+	post). */
+
+	configASSERT( pxQueue );
+
+	/* xQueueGenericSendFromISR() should be used instead of xQueueGiveFromISR()
+	if the item size is not 0. */
+	configASSERT( pxQueue->uxItemSize == 0 );
+
+	/* Normally a mutex would not be given from an interrupt, especially if
+	there is a mutex holder, as priority inheritance makes no sense for an
+	interrupts, only tasks. */
+	configASSERT( !( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( pxQueue->pxMutexHolder != NULL ) ) );
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  Interrupts that are
+	above the maximum system call priority are kept permanently enabled, even
+	when the RTOS kernel is in a critical section, but cannot make any calls to
+	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+	failure if a FreeRTOS API function is called from an interrupt that has been
+	assigned a priority above the configured maximum system call priority.
+	Only FreeRTOS functions that end in FromISR can be called from interrupts
+	that have been assigned a priority at or (logically) below the maximum
+	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+	safe API to ensure interrupt entry is as fast and as simple as possible.
+	More information (albeit Cortex-M specific) is provided on the following
+	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+		/* When the queue is used to implement a semaphore no data is ever
+		moved through the queue but it is still valid to see if the queue 'has
+		space'. */
+		if( uxMessagesWaiting < pxQueue->uxLength )
+		{
+			const int8_t cTxLock = pxQueue->cTxLock;
+
+			traceQUEUE_SEND_FROM_ISR( pxQueue );
+
+			/* A task can only have an inherited priority if it is a mutex
+			holder - and if there is a mutex holder then the mutex cannot be
+			given from an ISR.  As this is the ISR version of the function it
+			can be assumed there is no mutex holder and no need to determine if
+			priority disinheritance is needed.  Simply increase the count of
+			messages (semaphores) available. */
+			pxQueue->uxMessagesWaiting = uxMessagesWaiting + 1;
+
+			/* The event list is not altered if the queue is locked.  This will
+			be done when the queue is unlocked later. */
+			if( cTxLock == queueUNLOCKED )
+			{
+				#if ( configUSE_QUEUE_SETS == 1 )
+				{
+					if( pxQueue->pxQueueSetContainer != NULL )
+					{
+						if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+						{
+							/* The semaphore is a member of a queue set, and
+							posting	to the queue set caused a higher priority
+							task to	unblock.  A context switch is required. */
+							if( pxHigherPriorityTaskWoken != NULL )
+							{
+								*pxHigherPriorityTaskWoken = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						{
+							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+							{
+								/* The task waiting has a higher priority so
+								record that a context switch is required. */
+								if( pxHigherPriorityTaskWoken != NULL )
+								{
+									*pxHigherPriorityTaskWoken = pdTRUE;
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+				}
+				#else /* configUSE_QUEUE_SETS */
+				{
+					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					{
+						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+						{
+							/* The task waiting has a higher priority so record that a
+							context	switch is required. */
+							if( pxHigherPriorityTaskWoken != NULL )
+							{
+								*pxHigherPriorityTaskWoken = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_QUEUE_SETS */
+
+				// [ILG]
+				#if ( configUSE_MULTI_WAIT == 1 )
+				{
+					if( ( prvNotifyMultiWaiters( pxQueue ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+			}
+			else
+			{
+				/* Increment the lock count so the task that unlocks the queue
+				knows that data was posted while it was locked. */
+				pxQueue->cTxLock = ( int8_t ) ( cTxLock + 1 );
+			}
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+			xReturn = errQUEUE_FULL;
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueGenericReceive( QueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait, const BaseType_t xJustPeeking )
+{
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+int8_t *pcOriginalReadPosition;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+// [ILG]
+#if ( configUSE_QUEUE_HANDOFF == 1 )
+	BaseType_t xHandoffRecorded = pdFALSE;
+#endif
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	/* This function relaxes the coding standard somewhat to allow return
+	statements within the function itself.  This is done in the interest
+	of execution time efficiency. */
+
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+			// [ILG]
+			#if ( configUSE_QUEUE_HANDOFF == 1 )
+			{
+				if( xHandoffRecorded != pdFALSE )
+				{
+					xHandoffRecorded = pdFALSE;
+
+					/* A sender clears the recorded buffer when it copies an
+					item straight into it, so an already cleared buffer means
+					this task was unblocked holding the item. */
+					if( pvTaskTakeHandoffBuffer( NULL ) == NULL )
+					{
+						traceQUEUE_RECEIVE( pxQueue );
+						taskEXIT_CRITICAL();
+						return pdPASS;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_QUEUE_HANDOFF */
+
+			/* Is there data in the queue now?  To be running the calling task
+			must be the highest priority task wanting to access the queue. */
+			if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+			{
+				/* Remember the read position in case the queue is only being
+				peeked. */
+				pcOriginalReadPosition = pxQueue->u.pcReadFrom;
+
+				prvCopyDataFromQueue( pxQueue, pvBuffer );
+
+				if( xJustPeeking == pdFALSE )
+				{
+					traceQUEUE_RECEIVE( pxQueue );
+
+					/* Actually removing data, not just peeking. */
+					pxQueue->uxMessagesWaiting = uxMessagesWaiting - 1;
+
+					#if ( configUSE_MUTEXES == 1 )
+					{
+						if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+						{
+							/* Record the information required to implement
+							priority inheritance should it become necessary. */
+							pxQueue->pxMutexHolder = ( int8_t * ) pvTaskIncrementMutexHeldCount( &( pxQueue->xMutexLink ) ); /*lint !e961 Cast is not redundant as TaskHandle_t is a typedef. */
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif /* configUSE_MUTEXES */
+
+					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+					{
+						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+						{
+							queueYIELD_IF_USING_PREEMPTION();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					traceQUEUE_PEEK( pxQueue );
+
+					/* The data is not being removed, so reset the read
+					pointer. */
+					pxQueue->u.pcReadFrom = pcOriginalReadPosition;
+
+					/* The data is being left in the queue, so see if there are
+					any other tasks waiting for the data. */
+					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					{
+						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+						{
+							/* The task waiting has a higher priority than this task. */
+							queueYIELD_IF_USING_PREEMPTION();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+
+				taskEXIT_CRITICAL();
+				return pdPASS;
+			}
+			else
+			{
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					/* The queue was empty and no block time is specified (or
+					the block time has expired) so leave now. */
+					taskEXIT_CRITICAL();
+					traceQUEUE_RECEIVE_FAILED( pxQueue );
+					return errQUEUE_EMPTY;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					/* The queue was empty and a block time was specified so
+					configure the timeout structure. */
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* Interrupts and other tasks can send to and receive from the queue
+		now the critical section has been exited. */
+
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+
+				// [ILG]
+				#if ( configUSE_QUEUE_HANDOFF == 1 )
+				{
+					/* Let a sender copy the item straight into pvBuffer,
+					rather than into the storage area for this task to copy it
+					out again, possibly after a higher priority task took it. */
+					if( ( xJustPeeking == pdFALSE ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0 ) )
+					{
+						vTaskSetHandoffBuffer( pvBuffer );
+						xHandoffRecorded = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_QUEUE_HANDOFF */
+
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+
+				#if ( configUSE_MUTEXES == 1 )
+				{
+					/* The calling task is now in the list of waiting tasks, from
+					where the holders along the chain of mutexes inherit its
+					priority. */
+					if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+					{
+						taskENTER_CRITICAL();
+						{
+							vTaskPriorityInherit( &( pxQueue->xMutexLink ) );
+						}
+						taskEXIT_CRITICAL();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
+				prvUnlockQueue( pxQueue );
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* Try again. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				#if ( configUSE_MUTEXES == 1 )
+				{
+					/* The holders along the chain of mutexes no longer inherit
+					the priority of the calling task. */
+					if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+					{
+						taskENTER_CRITICAL();
+						{
+							vTaskPriorityDisinheritAfterTimeout( &( pxQueue->xMutexLink ) );
+						}
+						taskEXIT_CRITICAL();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
+				traceQUEUE_RECEIVE_FAILED( pxQueue );
+				return errQUEUE_EMPTY;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	// [ILG]
+  return pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue, void * const pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  Interrupts that are
+	above the maximum system call priority are kept permanently enabled, even
+	when the RTOS kernel is in a critical section, but cannot make any calls to
+	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+	failure if a FreeRTOS API function is called from an interrupt that has been
+	assigned a priority above the configured maximum system call priority.
+	Only FreeRTOS functions that end in FromISR can be called from interrupts
+	that have been assigned a priority at or (logically) below the maximum
+	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+	safe API to ensure interrupt entry is as fast and as simple as possible.
+	More information (albeit Cortex-M specific) is provided on the following
+	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+		/* Cannot block in an ISR, so check there is data available. */
+		if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+		{
+			const int8_t cRxLock = pxQueue->cRxLock;
+
+			traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+			prvCopyDataFromQueue( pxQueue, pvBuffer );
+			pxQueue->uxMessagesWaiting = uxMessagesWaiting - 1;
+
+			/* If the queue is locked the event list will not be modified.
+			Instead update the lock count so the task that unlocks the queue
+			will know that an ISR has removed data while the queue was
+			locked. */
+			if( cRxLock == queueUNLOCKED )
 			{
-				#if ( configUSE_QUEUE_SETS == 1 )
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 				{
-					if( pxQueue->pxQueueSetContainer != NULL )
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 					{
-						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) != pdFALSE )
+						/* The task waiting has a higher priority than us so
+						force a context switch. */
+						if( pxHigherPriorityTaskWoken != NULL )
 						{
-							/* The queue is a member of a queue set, and posting
-							to the queue set caused a higher priority task to
-							unblock.  A context switch is required. */
-							if( pxHigherPriorityTaskWoken != NULL )
-							{
-								*pxHigherPriorityTaskWoken = pdTRUE;
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
+							*pxHigherPriorityTaskWoken = pdTRUE;
 						}
 						else
 						{
@@ -1006,141 +2801,280 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					}
 					else
 					{
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
-						{
-							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
-							{
-								/* The task waiting has a higher priority so
-								record that a context switch is required. */
-								if( pxHigherPriorityTaskWoken != NULL )
-								{
-									*pxHigherPriorityTaskWoken = pdTRUE;
-								}
-								else
-								{
-									mtCOVERAGE_TEST_MARKER();
-								}
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* Increment the lock count so the task that unlocks the queue
+				knows that data was removed while it was locked. */
+				pxQueue->cRxLock = ( int8_t ) ( cRxLock + 1 );
+			}
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
+{
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+int8_t *pcOriginalReadPosition;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  Interrupts that are
+	above the maximum system call priority are kept permanently enabled, even
+	when the RTOS kernel is in a critical section, but cannot make any calls to
+	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+	failure if a FreeRTOS API function is called from an interrupt that has been
+	assigned a priority above the configured maximum system call priority.
+	Only FreeRTOS functions that end in FromISR can be called from interrupts
+	that have been assigned a priority at or (logically) below the maximum
+	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+	safe API to ensure interrupt entry is as fast and as simple as possible.
+	More information (albeit Cortex-M specific) is provided on the following
+	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Cannot block in an ISR, so check there is data available. */
+		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+		{
+			traceQUEUE_PEEK_FROM_ISR( pxQueue );
+
+			/* Remember the read position so it can be reset as nothing is
+			actually being removed from the queue. */
+			pcOriginalReadPosition = pxQueue->u.pcReadFrom;
+			prvCopyDataFromQueue( pxQueue, pvBuffer );
+			pxQueue->u.pcReadFrom = pcOriginalReadPosition;
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+			traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+// [ILG]
+BaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxItemCount, TickType_t xTicksToWait )
+{
+BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
+TimeOut_t xTimeOut;
+UBaseType_t uxSpace;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvItems == NULL ) && ( uxItemCount != ( UBaseType_t ) 0U ) ) );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U ); /* Semaphores and mutexes hold no items. */
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	if( uxItemCount == ( UBaseType_t ) 0U )
+	{
+		return 0;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* As xQueueGenericSend(), except that as many of the items as fit are
+	copied within a single critical section, and the task only blocks while
+	there is no space at all. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			uxSpace = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+
+			if( uxSpace > ( UBaseType_t ) 0 )
+			{
+				if( uxSpace > uxItemCount )
+				{
+					uxSpace = uxItemCount;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceQUEUE_SEND( pxQueue );
+				prvCopyMultipleToQueue( pxQueue, ( const int8_t * ) pvItems, uxSpace );
+
+				#if ( configUSE_QUEUE_SETS == 1 )
+				{
+					if( pxQueue->pxQueueSetContainer != NULL )
+					{
+						xYieldRequired = prvNotifyQueueSetContainerMultiple( pxQueue, uxSpace );
+					}
+					else
+					{
+						xYieldRequired = prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToReceive ), uxSpace );
+					}
+				}
+				#else /* configUSE_QUEUE_SETS */
+				{
+					xYieldRequired = prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToReceive ), uxSpace );
+				}
+				#endif /* configUSE_QUEUE_SETS */
+
+				// [ILG]
+				#if ( configUSE_MULTI_WAIT == 1 )
+				{
+					if( prvNotifyMultiWaiters( pxQueue ) != pdFALSE )
+					{
+						xYieldRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
 					}
 				}
-				#else /* configUSE_QUEUE_SETS */
+				#endif
+
+				if( xYieldRequired != pdFALSE )
+				{
+					/* A task with a priority higher than our own was
+					unblocked, so yield immediately.  Yes it is ok to do this
+					from within the critical section - the kernel takes care
+					of that. */
+					queueYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return ( BaseType_t ) uxSpace;
+			}
+			else
+			{
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					/* The queue was full and no block time is specified (or
+					the block time has expired) so leave now. */
+					taskEXIT_CRITICAL();
+					traceQUEUE_SEND_FAILED( pxQueue );
+					return 0;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
+
+				if( xTaskResumeAll() == pdFALSE )
 				{
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
-					{
-						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
-						{
-							/* The task waiting has a higher priority so record that a
-							context	switch is required. */
-							if( pxHigherPriorityTaskWoken != NULL )
-							{
-								*pxHigherPriorityTaskWoken = pdTRUE;
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					portYIELD_WITHIN_API();
 				}
-				#endif /* configUSE_QUEUE_SETS */
 			}
 			else
 			{
-				/* Increment the lock count so the task that unlocks the queue
-				knows that data was posted while it was locked. */
-				pxQueue->cTxLock = ( int8_t ) ( cTxLock + 1 );
+				/* Try again. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
 			}
-
-			xReturn = pdPASS;
 		}
 		else
 		{
-			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
-			xReturn = errQUEUE_FULL;
+			/* The timeout has expired. */
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			traceQUEUE_SEND_FAILED( pxQueue );
+			return 0;
 		}
 	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-
-	return xReturn;
+	// [ILG]
+  return 0;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken )
+// [ILG]
+BaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken )
 {
-BaseType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
+BaseType_t xYieldRequired = pdFALSE;
+UBaseType_t uxSavedInterruptStatus, uxSpace;
 Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
-	/* Similar to xQueueGenericSendFromISR() but used with semaphores where the
-	item size is 0.  Don't directly wake a task that was blocked on a queue
-	read, instead return a flag to say whether a context switch is required or
-	not (i.e. has a task with a higher priority than us been woken by this
-	post). */
-
 	configASSERT( pxQueue );
+	configASSERT( !( ( pvItems == NULL ) && ( uxItemCount != ( UBaseType_t ) 0U ) ) );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U ); /* Semaphores and mutexes hold no items. */
 
-	/* xQueueGenericSendFromISR() should be used instead of xQueueGiveFromISR()
-	if the item size is not 0. */
-	configASSERT( pxQueue->uxItemSize == 0 );
-
-	/* Normally a mutex would not be given from an interrupt, especially if
-	there is a mutex holder, as priority inheritance makes no sense for an
-	interrupts, only tasks. */
-	configASSERT( !( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( pxQueue->pxMutexHolder != NULL ) ) );
-
-	/* RTOS ports that support interrupt nesting have the concept of a maximum
-	system call (or maximum API call) interrupt priority.  Interrupts that are
-	above the maximum system call priority are kept permanently enabled, even
-	when the RTOS kernel is in a critical section, but cannot make any calls to
-	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-	failure if a FreeRTOS API function is called from an interrupt that has been
-	assigned a priority above the configured maximum system call priority.
-	Only FreeRTOS functions that end in FromISR can be called from interrupts
-	that have been assigned a priority at or (logically) below the maximum
-	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
-	safe API to ensure interrupt entry is as fast and as simple as possible.
-	More information (albeit Cortex-M specific) is provided on the following
-	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	/* See the comment in xQueueGenericSendFromISR(). */
 	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
 	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 	{
-		const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+		uxSpace = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+		if( uxSpace > uxItemCount )
+		{
+			uxSpace = uxItemCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-		/* When the queue is used to implement a semaphore no data is ever
-		moved through the queue but it is still valid to see if the queue 'has
-		space'. */
-		if( uxMessagesWaiting < pxQueue->uxLength )
+		if( uxSpace > ( UBaseType_t ) 0 )
 		{
 			const int8_t cTxLock = pxQueue->cTxLock;
 
 			traceQUEUE_SEND_FROM_ISR( pxQueue );
-
-			/* A task can only have an inherited priority if it is a mutex
-			holder - and if there is a mutex holder then the mutex cannot be
-			given from an ISR.  As this is the ISR version of the function it
-			can be assumed there is no mutex holder and no need to determine if
-			priority disinheritance is needed.  Simply increase the count of
-			messages (semaphores) available. */
-			pxQueue->uxMessagesWaiting = uxMessagesWaiting + 1;
+			prvCopyMultipleToQueue( pxQueue, ( const int8_t * ) pvItems, uxSpace );
 
 			/* The event list is not altered if the queue is locked.  This will
 			be done when the queue is unlocked later. */
@@ -1150,206 +3084,122 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				{
 					if( pxQueue->pxQueueSetContainer != NULL )
 					{
-						if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
-						{
-							/* The semaphore is a member of a queue set, and
-							posting	to the queue set caused a higher priority
-							task to	unblock.  A context switch is required. */
-							if( pxHigherPriorityTaskWoken != NULL )
-							{
-								*pxHigherPriorityTaskWoken = pdTRUE;
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+						xYieldRequired = prvNotifyQueueSetContainerMultiple( pxQueue, uxSpace );
 					}
 					else
 					{
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
-						{
-							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
-							{
-								/* The task waiting has a higher priority so
-								record that a context switch is required. */
-								if( pxHigherPriorityTaskWoken != NULL )
-								{
-									*pxHigherPriorityTaskWoken = pdTRUE;
-								}
-								else
-								{
-									mtCOVERAGE_TEST_MARKER();
-								}
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+						xYieldRequired = prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToReceive ), uxSpace );
 					}
 				}
 				#else /* configUSE_QUEUE_SETS */
 				{
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					xYieldRequired = prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToReceive ), uxSpace );
+				}
+				#endif /* configUSE_QUEUE_SETS */
+
+				// [ILG]
+				#if ( configUSE_MULTI_WAIT == 1 )
+				{
+					if( prvNotifyMultiWaiters( pxQueue ) != pdFALSE )
 					{
-						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
-						{
-							/* The task waiting has a higher priority so record that a
-							context	switch is required. */
-							if( pxHigherPriorityTaskWoken != NULL )
-							{
-								*pxHigherPriorityTaskWoken = pdTRUE;
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+						xYieldRequired = pdTRUE;
 					}
 					else
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
 				}
-				#endif /* configUSE_QUEUE_SETS */
+				#endif
 			}
 			else
 			{
-				/* Increment the lock count so the task that unlocks the queue
-				knows that data was posted while it was locked. */
-				pxQueue->cTxLock = ( int8_t ) ( cTxLock + 1 );
+				/* Increment the lock count by the number of items posted, so
+				the task that unlocks the queue can unblock that many
+				receivers. */
+				pxQueue->cTxLock = prvAddToLockCount( cTxLock, uxSpace );
 			}
-
-			xReturn = pdPASS;
 		}
 		else
 		{
 			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
-			xReturn = errQUEUE_FULL;
 		}
 	}
 	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-	return xReturn;
+	if( ( xYieldRequired != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+	{
+		*pxHigherPriorityTaskWoken = pdTRUE;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return ( BaseType_t ) uxSpace;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueueGenericReceive( QueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait, const BaseType_t xJustPeeking )
+// [ILG]
+BaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxItemCount, TickType_t xTicksToWait )
 {
 BaseType_t xEntryTimeSet = pdFALSE;
 TimeOut_t xTimeOut;
-int8_t *pcOriginalReadPosition;
+UBaseType_t uxReceived;
 Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
 	configASSERT( pxQueue );
-	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	configASSERT( !( ( pvBuffer == NULL ) && ( uxItemCount != ( UBaseType_t ) 0U ) ) );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U ); /* Semaphores and mutexes hold no items. */
 	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 	{
 		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
 	}
 	#endif
 
-	/* This function relaxes the coding standard somewhat to allow return
-	statements within the function itself.  This is done in the interest
-	of execution time efficiency. */
+	if( uxItemCount == ( UBaseType_t ) 0U )
+	{
+		return 0;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 
+	/* As xQueueGenericReceive(), except that as many of the requested items
+	as are available are copied within a single critical section, and the
+	task only blocks while the queue is empty. */
 	for( ;; )
 	{
 		taskENTER_CRITICAL();
 		{
-			const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+			uxReceived = pxQueue->uxMessagesWaiting;
 
-			/* Is there data in the queue now?  To be running the calling task
-			must be the highest priority task wanting to access the queue. */
-			if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+			if( uxReceived > ( UBaseType_t ) 0 )
 			{
-				/* Remember the read position in case the queue is only being
-				peeked. */
-				pcOriginalReadPosition = pxQueue->u.pcReadFrom;
-
-				prvCopyDataFromQueue( pxQueue, pvBuffer );
-
-				if( xJustPeeking == pdFALSE )
+				if( uxReceived > uxItemCount )
 				{
-					traceQUEUE_RECEIVE( pxQueue );
-
-					/* Actually removing data, not just peeking. */
-					pxQueue->uxMessagesWaiting = uxMessagesWaiting - 1;
-
-					#if ( configUSE_MUTEXES == 1 )
-					{
-						if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
-						{
-							/* Record the information required to implement
-							priority inheritance should it become necessary. */
-							pxQueue->pxMutexHolder = ( int8_t * ) pvTaskIncrementMutexHeldCount(); /*lint !e961 Cast is not redundant as TaskHandle_t is a typedef. */
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-					}
-					#endif /* configUSE_MUTEXES */
+					uxReceived = uxItemCount;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
-					{
-						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
-						{
-							queueYIELD_IF_USING_PREEMPTION();
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+				traceQUEUE_RECEIVE( pxQueue );
+				prvCopyMultipleFromQueue( pxQueue, ( int8_t * ) pvBuffer, uxReceived );
+
+				/* Each slot freed can satisfy one task waiting to send. */
+				if( prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToSend ), uxReceived ) != pdFALSE )
+				{
+					queueYIELD_IF_USING_PREEMPTION();
 				}
 				else
 				{
-					traceQUEUE_PEEK( pxQueue );
-
-					/* The data is not being removed, so reset the read
-					pointer. */
-					pxQueue->u.pcReadFrom = pcOriginalReadPosition;
-
-					/* The data is being left in the queue, so see if there are
-					any other tasks waiting for the data. */
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
-					{
-						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
-						{
-							/* The task waiting has a higher priority than this task. */
-							queueYIELD_IF_USING_PREEMPTION();
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					mtCOVERAGE_TEST_MARKER();
 				}
 
 				taskEXIT_CRITICAL();
-				return pdPASS;
+				return ( BaseType_t ) uxReceived;
 			}
 			else
 			{
@@ -1359,12 +3209,10 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					the block time has expired) so leave now. */
 					taskEXIT_CRITICAL();
 					traceQUEUE_RECEIVE_FAILED( pxQueue );
-					return errQUEUE_EMPTY;
+					return 0;
 				}
 				else if( xEntryTimeSet == pdFALSE )
 				{
-					/* The queue was empty and a block time was specified so
-					configure the timeout structure. */
 					vTaskSetTimeOutState( &xTimeOut );
 					xEntryTimeSet = pdTRUE;
 				}
@@ -1377,9 +3225,6 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		}
 		taskEXIT_CRITICAL();
 
-		/* Interrupts and other tasks can send to and receive from the queue
-		now the critical section has been exited. */
-
 		vTaskSuspendAll();
 		prvLockQueue( pxQueue );
 
@@ -1389,26 +3234,9 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
 			{
 				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
-
-				#if ( configUSE_MUTEXES == 1 )
-				{
-					if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
-					{
-						taskENTER_CRITICAL();
-						{
-							vTaskPriorityInherit( ( void * ) pxQueue->pxMutexHolder );
-						}
-						taskEXIT_CRITICAL();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-				#endif
-
 				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
 				prvUnlockQueue( pxQueue );
+
 				if( xTaskResumeAll() == pdFALSE )
 				{
 					portYIELD_WITHIN_API();
@@ -1433,7 +3261,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
 			{
 				traceQUEUE_RECEIVE_FAILED( pxQueue );
-				return errQUEUE_EMPTY;
+				return 0;
 			}
 			else
 			{
@@ -1442,153 +3270,329 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		}
 	}
 	// [ILG]
-  return pdFAIL;
+  return 0;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue, void * const pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken )
+// [ILG]
+BaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken )
 {
-BaseType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
+BaseType_t xYieldRequired = pdFALSE;
+UBaseType_t uxSavedInterruptStatus, uxReceived;
 Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
 	configASSERT( pxQueue );
-	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	configASSERT( !( ( pvBuffer == NULL ) && ( uxItemCount != ( UBaseType_t ) 0U ) ) );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U ); /* Semaphores and mutexes hold no items. */
 
-	/* RTOS ports that support interrupt nesting have the concept of a maximum
-	system call (or maximum API call) interrupt priority.  Interrupts that are
-	above the maximum system call priority are kept permanently enabled, even
-	when the RTOS kernel is in a critical section, but cannot make any calls to
-	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-	failure if a FreeRTOS API function is called from an interrupt that has been
-	assigned a priority above the configured maximum system call priority.
-	Only FreeRTOS functions that end in FromISR can be called from interrupts
-	that have been assigned a priority at or (logically) below the maximum
-	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
-	safe API to ensure interrupt entry is as fast and as simple as possible.
-	More information (albeit Cortex-M specific) is provided on the following
-	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	/* See the comment in xQueueGenericSendFromISR(). */
 	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
 	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 	{
-		const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+		uxReceived = pxQueue->uxMessagesWaiting;
+		if( uxReceived > uxItemCount )
+		{
+			uxReceived = uxItemCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-		/* Cannot block in an ISR, so check there is data available. */
-		if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+		if( uxReceived > ( UBaseType_t ) 0 )
 		{
 			const int8_t cRxLock = pxQueue->cRxLock;
 
 			traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
-
-			prvCopyDataFromQueue( pxQueue, pvBuffer );
-			pxQueue->uxMessagesWaiting = uxMessagesWaiting - 1;
+			prvCopyMultipleFromQueue( pxQueue, ( int8_t * ) pvBuffer, uxReceived );
 
 			/* If the queue is locked the event list will not be modified.
 			Instead update the lock count so the task that unlocks the queue
-			will know that an ISR has removed data while the queue was
-			locked. */
+			will know that ISRs have removed data while it was locked. */
 			if( cRxLock == queueUNLOCKED )
 			{
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				xYieldRequired = prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToSend ), uxReceived );
+			}
+			else
+			{
+				pxQueue->cRxLock = prvAddToLockCount( cRxLock, uxReceived );
+			}
+		}
+		else
+		{
+			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	if( ( xYieldRequired != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+	{
+		*pxHigherPriorityTaskWoken = pdTRUE;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return ( BaseType_t ) uxReceived;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+	// [ILG]
+	void *pvQueueReserveSlot( QueueHandle_t xQueue, TickType_t xTicksToWait )
+	{
+	BaseType_t xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
+	void *pvSlot;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U ); /* Semaphores and mutexes have no storage area. */
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
-					{
-						/* The task waiting has a higher priority than us so
-						force a context switch. */
-						if( pxHigherPriorityTaskWoken != NULL )
-						{
-							*pxHigherPriorityTaskWoken = pdTRUE;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					/* Only one slot can be reserved at a time, and no other
+					task may write to the queue until it is committed. */
+					configASSERT( ( pxQueue->ucZeroCopyState & queueSLOT_RESERVED ) == 0U );
+					pxQueue->ucZeroCopyState |= queueSLOT_RESERVED;
+
+					/* The slot is the one the next item would be copied to by
+					xQueueSend(). */
+					pvSlot = ( void * ) pxQueue->pcWriteTo;
+
+					taskEXIT_CRITICAL();
+					return pvSlot;
+				}
+				else if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					taskEXIT_CRITICAL();
+					traceQUEUE_SEND_FAILED( pxQueue );
+					return NULL;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
 				}
 				else
 				{
+					/* Entry time was already set. */
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
+			taskEXIT_CRITICAL();
+
+			prvWaitOnQueue( pxQueue, pdTRUE, &xTimeOut, &xTicksToWait );
+		}
+	}
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+	// [ILG]
+	void vQueueCommitSlot( QueueHandle_t xQueue )
+	{
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+	BaseType_t xYieldRequired;
+
+		configASSERT( pxQueue );
+
+		taskENTER_CRITICAL();
+		{
+			configASSERT( ( pxQueue->ucZeroCopyState & queueSLOT_RESERVED ) != 0U );
+			pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueSLOT_RESERVED;
+
+			traceQUEUE_SEND( pxQueue );
+
+			/* The item is already in place, so only the write position and
+			the item count are updated, as prvCopyDataToQueue() would. */
+			pxQueue->pcWriteTo += pxQueue->uxItemSize;
+			if( pxQueue->pcWriteTo >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+			{
+				pxQueue->pcWriteTo = pxQueue->pcHead;
+			}
 			else
 			{
-				/* Increment the lock count so the task that unlocks the queue
-				knows that data was removed while it was locked. */
-				pxQueue->cRxLock = ( int8_t ) ( cRxLock + 1 );
+				mtCOVERAGE_TEST_MARKER();
 			}
 
-			xReturn = pdPASS;
-		}
-		else
-		{
-			xReturn = pdFAIL;
-			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+			++( pxQueue->uxMessagesWaiting );
+
+			#if ( configUSE_QUEUE_SETS == 1 )
+			{
+				if( pxQueue->pxQueueSetContainer != NULL )
+				{
+					xYieldRequired = prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK );
+				}
+				else
+				{
+					xYieldRequired = prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToReceive ), 1 );
+				}
+			}
+			#else /* configUSE_QUEUE_SETS */
+			{
+				xYieldRequired = prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToReceive ), 1 );
+			}
+			#endif /* configUSE_QUEUE_SETS */
+
+			#if ( configUSE_MULTI_WAIT == 1 )
+			{
+				if( prvNotifyMultiWaiters( pxQueue ) != pdFALSE )
+				{
+					xYieldRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
+			if( xYieldRequired != pdFALSE )
+			{
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
+		taskEXIT_CRITICAL();
 	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-	return xReturn;
-}
+#endif /* configUSE_QUEUE_ZERO_COPY */
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
-{
-BaseType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
-int8_t *pcOriginalReadPosition;
-Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+	// [ILG]
+	void *pvQueueAcquireSlot( QueueHandle_t xQueue, TickType_t xTicksToWait )
+	{
+	BaseType_t xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
+	int8_t *pcSlot;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U ); /* Semaphores and mutexes have no storage area. */
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+				{
+					/* Only one slot can be acquired at a time, and no other
+					task may read from the queue until it is released. */
+					configASSERT( ( pxQueue->ucZeroCopyState & queueSLOT_ACQUIRED ) == 0U );
+					pxQueue->ucZeroCopyState |= queueSLOT_ACQUIRED;
+
+					/* The slot is the one the next item would be copied from
+					by xQueueReceive().  The item stays counted in the queue,
+					so its slot cannot be reused, until it is released. */
+					pcSlot = pxQueue->u.pcReadFrom + pxQueue->uxItemSize;
+					if( pcSlot >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+					{
+						pcSlot = pxQueue->pcHead;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					taskEXIT_CRITICAL();
+					return ( void * ) pcSlot;
+				}
+				else if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					taskEXIT_CRITICAL();
+					traceQUEUE_RECEIVE_FAILED( pxQueue );
+					return NULL;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
 
-	configASSERT( pxQueue );
-	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-	configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+			prvWaitOnQueue( pxQueue, pdFALSE, &xTimeOut, &xTicksToWait );
+		}
+	}
 
-	/* RTOS ports that support interrupt nesting have the concept of a maximum
-	system call (or maximum API call) interrupt priority.  Interrupts that are
-	above the maximum system call priority are kept permanently enabled, even
-	when the RTOS kernel is in a critical section, but cannot make any calls to
-	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-	failure if a FreeRTOS API function is called from an interrupt that has been
-	assigned a priority above the configured maximum system call priority.
-	Only FreeRTOS functions that end in FromISR can be called from interrupts
-	that have been assigned a priority at or (logically) below the maximum
-	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
-	safe API to ensure interrupt entry is as fast and as simple as possible.
-	More information (albeit Cortex-M specific) is provided on the following
-	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
-	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
 
-	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+	// [ILG]
+	void vQueueReleaseSlot( QueueHandle_t xQueue )
 	{
-		/* Cannot block in an ISR, so check there is data available. */
-		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
-		{
-			traceQUEUE_PEEK_FROM_ISR( pxQueue );
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
-			/* Remember the read position so it can be reset as nothing is
-			actually being removed from the queue. */
-			pcOriginalReadPosition = pxQueue->u.pcReadFrom;
-			prvCopyDataFromQueue( pxQueue, pvBuffer );
-			pxQueue->u.pcReadFrom = pcOriginalReadPosition;
+		configASSERT( pxQueue );
 
-			xReturn = pdPASS;
-		}
-		else
+		taskENTER_CRITICAL();
 		{
-			xReturn = pdFAIL;
-			traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+			configASSERT( ( pxQueue->ucZeroCopyState & queueSLOT_ACQUIRED ) != 0U );
+			pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueSLOT_ACQUIRED;
+
+			traceQUEUE_RECEIVE( pxQueue );
+
+			/* Remove the item, as prvCopyDataFromQueue() would but without
+			the copy. */
+			pxQueue->u.pcReadFrom += pxQueue->uxItemSize;
+			if( pxQueue->u.pcReadFrom >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+			{
+				pxQueue->u.pcReadFrom = pxQueue->pcHead;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			--( pxQueue->uxMessagesWaiting );
+
+			/* There is now space in the queue, so a task waiting to post to
+			it can be unblocked. */
+			if( prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToSend ), 1 ) != pdFALSE )
+			{
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
+		taskEXIT_CRITICAL();
 	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-	return xReturn;
-}
+#endif /* configUSE_QUEUE_ZERO_COPY */
 /*-----------------------------------------------------------*/
 
 UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
@@ -1625,151 +3629,482 @@ Queue_t *pxQueue;
 } /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+{
+UBaseType_t uxReturn;
+
+	configASSERT( xQueue );
+
+	uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
+
+	return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+void vQueueDelete( QueueHandle_t xQueue )
+{
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	traceQUEUE_DELETE( pxQueue );
+
+	// [ILG]
+	#if ( configUSE_MULTI_WAIT == 1 )
+	{
+		/* A queue must not be deleted while a task is waiting on it. */
+		configASSERT( listLIST_IS_EMPTY( &( pxQueue->xMultiWaiters ) ) != pdFALSE );
+	}
+	#endif
+
+	#if ( configQUEUE_REGISTRY_SIZE > 0 )
+	{
+		vQueueUnregisterQueue( pxQueue );
+	}
+	#endif
+
+	#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+	{
+		/* The queue can only have been allocated dynamically - free it
+		again. */
+		vPortFree( pxQueue );
+	}
+	#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	{
+		/* The queue could have been allocated statically or dynamically, so
+		check before attempting to free the memory. */
+		if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+		{
+			vPortFree( pxQueue );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+		/* The queue must have been statically allocated, so is not going to be
+		deleted.  Avoid compiler warnings about the unused parameter. */
+		( void ) pxQueue;
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
+	{
+		return ( ( Queue_t * ) xQueue )->uxQueueNumber;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	void vQueueSetQueueNumber( QueueHandle_t xQueue, UBaseType_t uxQueueNumber )
+	{
+		( ( Queue_t * ) xQueue )->uxQueueNumber = uxQueueNumber;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	uint8_t ucQueueGetQueueType( QueueHandle_t xQueue )
+	{
+		return ( ( Queue_t * ) xQueue )->ucQueueType;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvItemToQueue, const BaseType_t xPosition )
+{
+BaseType_t xReturn = pdFALSE;
+UBaseType_t uxMessagesWaiting;
+
+	/* This function is called from a critical section. */
+
+	uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+	// [ILG]
+	#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+	{
+		/* No other task may write to the queue while a slot is reserved, or
+		write to its front while a slot is acquired. */
+		configASSERT( ( pxQueue->ucZeroCopyState & queueSLOT_RESERVED ) == 0U );
+		configASSERT( !( ( xPosition != queueSEND_TO_BACK ) && ( ( pxQueue->ucZeroCopyState & queueSLOT_ACQUIRED ) != 0U ) ) );
+	}
+	#endif
+
+	if( pxQueue->uxItemSize == ( UBaseType_t ) 0 )
+	{
+		#if ( configUSE_MUTEXES == 1 )
+		{
+			if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+			{
+				/* The mutex is no longer being held. */
+				xReturn = xTaskPriorityDisinherit( &( pxQueue->xMutexLink ) );
+				pxQueue->pxMutexHolder = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_MUTEXES */
+	}
+	else if( xPosition == queueSEND_TO_BACK )
+	{
+		( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports, plus previous logic ensures a null pointer can only be passed to memcpy() if the copy size is 0. */
+		pxQueue->pcWriteTo += pxQueue->uxItemSize;
+		if( pxQueue->pcWriteTo >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+		{
+			pxQueue->pcWriteTo = pxQueue->pcHead;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		( void ) memcpy( ( void * ) pxQueue->u.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		pxQueue->u.pcReadFrom -= pxQueue->uxItemSize;
+		if( pxQueue->u.pcReadFrom < pxQueue->pcHead ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+		{
+			pxQueue->u.pcReadFrom = ( pxQueue->pcTail - pxQueue->uxItemSize );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( xPosition == queueOVERWRITE )
+		{
+			if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+			{
+				/* An item is not being added but overwritten, so subtract
+				one from the recorded number of items in the queue so when
+				one is added again below the number of recorded items remains
+				correct. */
+				--uxMessagesWaiting;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	pxQueue->uxMessagesWaiting = uxMessagesWaiting + 1;
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer )
+{
+	// [ILG]
+	#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+	{
+		/* No other task may read from the queue while a slot is acquired. */
+		configASSERT( ( pxQueue->ucZeroCopyState & queueSLOT_ACQUIRED ) == 0U );
+	}
+	#endif
+
+	if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
+	{
+		pxQueue->u.pcReadFrom += pxQueue->uxItemSize;
+		if( pxQueue->u.pcReadFrom >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+		{
+			pxQueue->u.pcReadFrom = pxQueue->pcHead;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+		( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.pcReadFrom, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports.  Also previous logic ensures a null pointer can only be passed to memcpy() when the count is 0. */
+	}
+}
+/*-----------------------------------------------------------*/
+
+// [ILG]
+static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const int8_t *pcItems, const UBaseType_t uxItemCount )
 {
-UBaseType_t uxReturn;
-
-	configASSERT( xQueue );
+size_t xFirstSize, xTotalSize;
 
-	uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
-
-	return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
-/*-----------------------------------------------------------*/
+	/* This function is called from a critical section. */
 
-void vQueueDelete( QueueHandle_t xQueue )
-{
-Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+	#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+	{
+		configASSERT( ( pxQueue->ucZeroCopyState & queueSLOT_RESERVED ) == 0U );
+	}
+	#endif
 
-	configASSERT( pxQueue );
-	traceQUEUE_DELETE( pxQueue );
+	xTotalSize = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
 
-	#if ( configQUEUE_REGISTRY_SIZE > 0 )
+	/* The first segment runs from the write position to the end of the
+	storage area, the second (if any) from the start of the storage area. */
+	xFirstSize = ( size_t ) ( pxQueue->pcTail - pxQueue->pcWriteTo );
+	if( xFirstSize > xTotalSize )
 	{
-		vQueueUnregisterQueue( pxQueue );
+		xFirstSize = xTotalSize;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
 	}
-	#endif
 
-	#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+	( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) pcItems, xFirstSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+	pxQueue->pcWriteTo += xFirstSize;
+
+	if( xFirstSize < xTotalSize )
 	{
-		/* The queue can only have been allocated dynamically - free it
-		again. */
-		vPortFree( pxQueue );
+		( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) ( pcItems + xFirstSize ), xTotalSize - xFirstSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		pxQueue->pcWriteTo = pxQueue->pcHead + ( xTotalSize - xFirstSize );
 	}
-	#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	else if( pxQueue->pcWriteTo >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
 	{
-		/* The queue could have been allocated statically or dynamically, so
-		check before attempting to free the memory. */
-		if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
-		{
-			vPortFree( pxQueue );
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
+		pxQueue->pcWriteTo = pxQueue->pcHead;
 	}
-	#else
+	else
 	{
-		/* The queue must have been statically allocated, so is not going to be
-		deleted.  Avoid compiler warnings about the unused parameter. */
-		( void ) pxQueue;
+		mtCOVERAGE_TEST_MARKER();
 	}
-	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+	pxQueue->uxMessagesWaiting += uxItemCount;
 }
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+// [ILG]
+static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, int8_t *pcBuffer, const UBaseType_t uxItemCount )
+{
+size_t xFirstSize, xTotalSize;
+int8_t *pcReadFrom;
 
-	UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
+	/* This function is called from a critical section.  pcReadFrom points
+	to the last item read, so the first item to read is the next one. */
+
+	#if ( configUSE_QUEUE_ZERO_COPY == 1 )
 	{
-		return ( ( Queue_t * ) xQueue )->uxQueueNumber;
+		configASSERT( ( pxQueue->ucZeroCopyState & queueSLOT_ACQUIRED ) == 0U );
 	}
+	#endif
 
-#endif /* configUSE_TRACE_FACILITY */
-/*-----------------------------------------------------------*/
-
-#if ( configUSE_TRACE_FACILITY == 1 )
+	xTotalSize = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
 
-	void vQueueSetQueueNumber( QueueHandle_t xQueue, UBaseType_t uxQueueNumber )
+	pcReadFrom = pxQueue->u.pcReadFrom + pxQueue->uxItemSize;
+	if( pcReadFrom >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
 	{
-		( ( Queue_t * ) xQueue )->uxQueueNumber = uxQueueNumber;
+		pcReadFrom = pxQueue->pcHead;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
 	}
 
-#endif /* configUSE_TRACE_FACILITY */
-/*-----------------------------------------------------------*/
+	xFirstSize = ( size_t ) ( pxQueue->pcTail - pcReadFrom );
+	if( xFirstSize > xTotalSize )
+	{
+		xFirstSize = xTotalSize;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+	( void ) memcpy( ( void * ) pcBuffer, ( void * ) pcReadFrom, xFirstSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
-	uint8_t ucQueueGetQueueType( QueueHandle_t xQueue )
+	if( xFirstSize < xTotalSize )
 	{
-		return ( ( Queue_t * ) xQueue )->ucQueueType;
+		( void ) memcpy( ( void * ) ( pcBuffer + xFirstSize ), ( void * ) pxQueue->pcHead, xTotalSize - xFirstSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		pcReadFrom = pxQueue->pcHead + ( xTotalSize - xFirstSize );
+	}
+	else
+	{
+		pcReadFrom += xFirstSize;
 	}
 
-#endif /* configUSE_TRACE_FACILITY */
+	/* Leave pcReadFrom pointing to the last item read, as
+	prvCopyDataFromQueue() does. */
+	pxQueue->u.pcReadFrom = pcReadFrom - pxQueue->uxItemSize;
+	pxQueue->uxMessagesWaiting -= uxItemCount;
+}
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvItemToQueue, const BaseType_t xPosition )
+// [ILG]
+static BaseType_t prvUnblockMultipleWaiters( List_t * const pxEventList, UBaseType_t uxItemCount )
 {
 BaseType_t xReturn = pdFALSE;
-UBaseType_t uxMessagesWaiting;
 
-	/* This function is called from a critical section. */
+	/* Each item moved can satisfy one waiting task, so unblock at most
+	uxItemCount of them.  The list is ordered by priority so the highest
+	priority waiters are the ones released. */
+	while( ( uxItemCount > ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+	{
+		if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-	uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+		--uxItemCount;
+	}
 
-	if( pxQueue->uxItemSize == ( UBaseType_t ) 0 )
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_SETS == 1 )
+
+	// [ILG]
+	static BaseType_t prvNotifyQueueSetContainerMultiple( const Queue_t * const pxQueue, UBaseType_t uxItemCount )
 	{
-		#if ( configUSE_MUTEXES == 1 )
+	BaseType_t xReturn = pdFALSE;
+
+		/* The queue set holds one handle for each item in its member
+		queues. */
+		while( uxItemCount > ( UBaseType_t ) 0 )
 		{
-			if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+			if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
 			{
-				/* The mutex is no longer being held. */
-				xReturn = xTaskPriorityDisinherit( ( void * ) pxQueue->pxMutexHolder );
-				pxQueue->pxMutexHolder = NULL;
+				xReturn = pdTRUE;
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
+
+			--uxItemCount;
 		}
-		#endif /* configUSE_MUTEXES */
+
+		return xReturn;
 	}
-	else if( xPosition == queueSEND_TO_BACK )
+
+#endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MULTI_WAIT == 1 )
+
+	// [ILG]
+	static BaseType_t prvNotifyMultiWaiters( const Queue_t * const pxQueue )
 	{
-		( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports, plus previous logic ensures a null pointer can only be passed to memcpy() if the copy size is 0. */
-		pxQueue->pcWriteTo += pxQueue->uxItemSize;
-		if( pxQueue->pcWriteTo >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+	BaseType_t xReturn;
+
+		if( listLIST_IS_EMPTY( &( pxQueue->xMultiWaiters ) ) == pdFALSE )
 		{
-			pxQueue->pcWriteTo = pxQueue->pcHead;
+			xReturn = xTaskWakeMultiWaiters( &( pxQueue->xMultiWaiters ), 0UL );
 		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			xReturn = pdFALSE;
 		}
+
+		return xReturn;
 	}
-	else
+
+#endif /* configUSE_MULTI_WAIT */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MULTI_WAIT == 1 )
+
+	// [ILG]
+	BaseType_t xQueueAddMultiWaiter( QueueHandle_t xQueue, ListItem_t * const pxWaiterListItem )
 	{
-		( void ) memcpy( ( void * ) pxQueue->u.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-		pxQueue->u.pcReadFrom -= pxQueue->uxItemSize;
-		if( pxQueue->u.pcReadFrom < pxQueue->pcHead ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+	BaseType_t xReturn;
+
+		configASSERT( pxQueue );
+
+		/* This function must be called from a critical section. */
+
+		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0U )
 		{
-			pxQueue->u.pcReadFrom = ( pxQueue->pcTail - pxQueue->uxItemSize );
+			/* Nothing to wait for. */
+			xReturn = pdTRUE;
 		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			vListInsertEnd( &( pxQueue->xMultiWaiters ), pxWaiterListItem );
+			xReturn = pdFALSE;
 		}
 
-		if( xPosition == queueOVERWRITE )
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTI_WAIT */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+	// [ILG]
+	static void prvWaitOnQueue( Queue_t * const pxQueue, const BaseType_t xWaitingToSend, TimeOut_t * const pxTimeOut, TickType_t * const pxTicksToWait )
+	{
+	BaseType_t xBlocked = pdFALSE;
+
+		/* Interrupts and other tasks can send to and receive from the queue
+		now the critical section has been exited. */
+
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( pxTimeOut, pxTicksToWait ) == pdFALSE )
 		{
-			if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+			if( xWaitingToSend != pdFALSE )
 			{
-				/* An item is not being added but overwritten, so subtract
-				one from the recorded number of items in the queue so when
-				one is added again below the number of recorded items remains
-				correct. */
-				--uxMessagesWaiting;
+				if( prvIsQueueFull( pxQueue ) != pdFALSE )
+				{
+					traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), *pxTicksToWait );
+					xBlocked = pdTRUE;
+				}
+				else
+				{
+					/* Try again. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+				{
+					traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), *pxTicksToWait );
+					xBlocked = pdTRUE;
+				}
+				else
+				{
+					/* Try again. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		else
+		{
+			/* The timeout has expired, so the caller has one last look at
+			the queue without blocking. */
+			*pxTicksToWait = ( TickType_t ) 0;
+		}
+
+		prvUnlockQueue( pxQueue );
+
+		if( xTaskResumeAll() == pdFALSE )
+		{
+			if( xBlocked != pdFALSE )
+			{
+				portYIELD_WITHIN_API();
 			}
 			else
 			{
@@ -1782,28 +4117,59 @@ UBaseType_t uxMessagesWaiting;
 		}
 	}
 
-	pxQueue->uxMessagesWaiting = uxMessagesWaiting + 1;
-
-	return xReturn;
-}
+#endif /* configUSE_QUEUE_ZERO_COPY */
 /*-----------------------------------------------------------*/
 
-static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer )
-{
-	if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
+#if ( configUSE_QUEUE_HANDOFF == 1 )
+
+	// [ILG]
+	static BaseType_t prvHandOffToReceiver( Queue_t * const pxQueue, const void * const pvItemToQueue, BaseType_t * const pxYieldRequired )
 	{
-		pxQueue->u.pcReadFrom += pxQueue->uxItemSize;
-		if( pxQueue->u.pcReadFrom >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+	BaseType_t xReturn = pdFALSE;
+	void *pvBuffer;
+
+		/* The item can only bypass the storage area if that cannot reorder
+		it, i.e. if the queue is empty.  Semaphores carry no item, and queue
+		set members have to hold the item for the set to reference it. */
+		if( ( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE ) )
 		{
-			pxQueue->u.pcReadFrom = pxQueue->pcHead;
+			#if ( configUSE_QUEUE_SETS == 1 )
+			{
+				if( pxQueue->pxQueueSetContainer != NULL )
+				{
+					return pdFALSE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_QUEUE_SETS */
+
+			/* Tasks that peek, or that receive without a buffer of their own,
+			do not record one. */
+			pvBuffer = pvTaskTakeHandoffBuffer( ( TaskHandle_t ) listGET_OWNER_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) ) );
+
+			if( pvBuffer != NULL )
+			{
+				( void ) memcpy( pvBuffer, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				*pxYieldRequired = xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) );
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
-		( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.pcReadFrom, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports.  Also previous logic ensures a null pointer can only be passed to memcpy() when the count is 0. */
+
+		return xReturn;
 	}
-}
+
+#endif /* configUSE_QUEUE_HANDOFF */
 /*-----------------------------------------------------------*/
 
 static void prvUnlockQueue( Queue_t * const pxQueue )
@@ -1818,6 +4184,22 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 	{
 		int8_t cTxLock = pxQueue->cTxLock;
 
+		// [ILG]
+		#if ( configUSE_MULTI_WAIT == 1 )
+		{
+			/* Tasks blocked in xTaskWaitForMultiple() are all woken once,
+			however many items were posted. */
+			if( ( cTxLock > queueLOCKED_UNMODIFIED ) && ( prvNotifyMultiWaiters( pxQueue ) != pdFALSE ) )
+			{
+				vTaskMissedYield();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif
+
 		/* See if data was added to the queue while it was locked. */
 		while( cTxLock > queueLOCKED_UNMODIFIED )
 		{
@@ -2552,6 +4934,20 @@ BaseType_t xReturn;
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+
+				// [ILG]
+				#if ( configUSE_MULTI_WAIT == 1 )
+				{
+					if( prvNotifyMultiWaiters( pxQueueSetContainer ) != pdFALSE )
+					{
+						xReturn = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
 			}
 			else
 			{
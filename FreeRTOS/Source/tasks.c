@@ -82,6 +82,12 @@ task.h is included from an application file. */
 #include "timers.h"
 #include "StackMacros.h"
 
+// [ILG]
+#if ( configUSE_MULTI_WAIT == 1 )
+	#include "queue.h"
+	#include "event_groups.h"
+#endif
+
 /* Lint e961 and e750 are suppressed as a MISRA exception justified because the
 MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
 header files above, but not in this file, in order to generate the correct
@@ -110,6 +116,8 @@ functions but without including stdio.h here. */
 #define taskNOT_WAITING_NOTIFICATION	( ( uint8_t ) 0 )
 #define taskWAITING_NOTIFICATION		( ( uint8_t ) 1 )
 #define taskNOTIFICATION_RECEIVED		( ( uint8_t ) 2 )
+#define taskWAITING_NOTIFICATION_ANY	( ( uint8_t ) 3 ) // [ILG]
+#define taskWAITING_NOTIFICATION_ALL	( ( uint8_t ) 4 )
 
 /*
  * The value used to fill the stack of a task when the task is created.  This
@@ -323,9 +331,34 @@ typedef struct tskTaskControlBlock
 		UBaseType_t		uxTaskNumber;		/*< Stores a number specifically for use by third party trace code. */
 	#endif
 
+	#if ( configUSE_TASK_ITERATOR == 1 )
+		ListItem_t		xRegistryListItem;	/*< Used to reference the task from the registry of all tasks, in creation order. */
+	#endif
+
 	#if ( configUSE_MUTEXES == 1 )
 		UBaseType_t		uxBasePriority;		/*< The priority last assigned to the task - used by the priority inheritance mechanism. */
 		UBaseType_t		uxMutexesHeld;
+		List_t			xMutexesHeldList;	/*< The mutexes held by the task - used to recompute the inherited priority each time a mutex is released. */
+		MutexLink_t		*pxBlockedOnMutex;	/*< The mutex the task is waiting for, if any - used to propagate inherited priorities along chains of mutexes. */
+	#endif
+
+	// [ILG]
+	#if ( configUSE_QUEUE_HANDOFF == 1 )
+		void			*pvHandoffBuffer;	/*< The buffer of a task blocked receiving from a queue, into which a sender can copy the item directly.  Set to NULL once the item has been delivered. */
+	#endif
+
+	#if ( configUSE_MULTI_WAIT == 1 )
+		WaitObject_t	*pxWaitObjects;		/*< The objects the task is blocked on in xTaskWaitForMultiple(), or NULL. */
+		UBaseType_t		uxWaitObjectCount;	/*< The number of entries in pxWaitObjects. */
+		volatile BaseType_t xWaitReadyIndex;/*< The index of the object that woke the task, or -1. */
+	#endif
+
+	#if ( configUSE_FULL_EVENT_BITS == 1 )
+		void			*pvEventWaiter;		/*< The record describing the bits the task waits for while blocked on an event group, or NULL. */
+	#endif
+
+	#if ( configUSE_TASK_OBJECT_POINTER == 1 )
+		void			*pvObject;			/*< The application object that represents the task, for example a C++ thread.  Read inline from the current TCB by taskGET_CURRENT_OBJECT_POINTER(). */
 	#endif
 
 	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
@@ -352,8 +385,11 @@ typedef struct tskTaskControlBlock
 	#endif
 
 	#if( configUSE_TASK_NOTIFICATIONS == 1 )
-		volatile uint32_t ulNotifiedValue;
-		volatile uint8_t ucNotifyState;
+		volatile uint32_t ulNotifiedValue[ configTASK_NOTIFICATION_ARRAY_ENTRIES ]; // [ILG]
+		volatile uint8_t ucNotifyState[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+		#if( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+			uint32_t ulNotifyWaitBits;	/*< The bits the task waits for in xTaskGenericNotifyWaitBits(). */ // [ILG]
+		#endif
 	#endif
 
 	/* See the comments above the definition of
@@ -403,6 +439,14 @@ PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been r
 
 #endif
 
+// [ILG]
+#if ( configUSE_TASK_ITERATOR == 1 )
+
+	PRIVILEGED_DATA static List_t xTaskRegistryList;					/*< All the tasks that exist, regardless of state, ordered by creation (and so by uxTCBNumber). */
+	PRIVILEGED_DATA static volatile UBaseType_t uxTaskRegistryGeneration = ( UBaseType_t ) 0U; /*< Incremented each time a task is removed from the registry, so iterators know their cursor may be stale. */
+
+#endif
+
 /* Other file private variables. --------------------------------*/
 PRIVILEGED_DATA static volatile UBaseType_t uxCurrentNumberOfTasks 	= ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile TickType_t xTickCount 				= ( TickType_t ) 0U;
@@ -590,6 +634,99 @@ static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
  */
 static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_MUTEXES == 1 )
+
+	/*
+	 * Returns the priority the task should run at, which is the highest of its
+	 * base priority, the priority ceilings of the mutexes it holds, and the
+	 * priorities of the highest priority tasks waiting for each of them.
+	 */
+	static UBaseType_t prvGetInheritedPriority( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Changes the priority being used by the task without changing its base
+	 * priority, moving the task to the matching ready list if necessary.
+	 * Returns pdTRUE if the change requires a context switch.
+	 */
+	static BaseType_t prvSetInheritedPriority( TCB_t * const pxTCB, UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * If the task is waiting for a mutex, re-sorts it within the list of tasks
+	 * waiting for that mutex and returns the holder of the mutex.  Otherwise
+	 * returns NULL.
+	 */
+	static TCB_t *prvGetBlockingMutexHolder( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Recomputes the priority of the task, and while the priority changes,
+	 * follows the chain of mutexes the task is waiting for recomputing the
+	 * priority of each holder in turn.  Returns pdTRUE if a context switch is
+	 * required.
+	 */
+	static BaseType_t prvUpdateInheritedPriority( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called when the task stops waiting for a mutex without obtaining it,
+	 * because it is being deleted or suspended, or because its block time
+	 * expired.
+	 */
+	static void prvStopWaitingForMutex( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_MUTEXES */
+
+// [ILG]
+#if ( configUSE_MULTI_WAIT == 1 )
+
+	/*
+	 * Unlink the waiter records of a task blocked in xTaskWaitForMultiple()
+	 * from the objects they are linked into.  Must be called from a critical
+	 * section.
+	 */
+	static void prvRemoveMultiWaitRecords( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called when a task blocked in xTaskWaitForMultiple() stops waiting for
+	 * any other reason than one of its objects becoming ready, because it is
+	 * being deleted or suspended.
+	 */
+	static void prvCancelMultiWait( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Record uxIndex as the object that made the task ready and unblock the
+	 * task, if it is still blocked in xTaskWaitForMultiple() and no other
+	 * object got there first.  Returns pdTRUE if the task has a priority above
+	 * the calling task.
+	 */
+	static BaseType_t prvWakeMultiWaiter( TCB_t * const pxTCB, const BaseType_t xIndex ) PRIVILEGED_FUNCTION;
+
+	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+		/*
+		 * Called when the notification value of a task has been updated, to
+		 * wake the task if it is blocked in xTaskWaitForMultiple() on bits of
+		 * the value that are now set.
+		 */
+		static BaseType_t prvNotifyMultiWaiter( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	#endif
+
+#endif /* configUSE_MULTI_WAIT */
+
+// [ILG]
+#if ( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+
+	/*
+	 * Called when the notification value at uxIndex has been updated, with the
+	 * notification state it had before.  If the task is blocked in
+	 * xTaskGenericNotifyWaitBits() and the new value does not satisfy its
+	 * condition, the waiting state is restored, so that the task remains
+	 * blocked.  Returns the state the caller should act on:
+	 * taskWAITING_NOTIFICATION if the task must be unblocked.
+	 */
+	static uint8_t prvCheckNotifyWaitBits( TCB_t * const pxTCB, const UBaseType_t uxIndex, const uint8_t ucOriginalNotifyState ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TASK_NOTIFY_WAIT_BITS */
+
 /*-----------------------------------------------------------*/
 
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -872,9 +1009,32 @@ UBaseType_t x;
 	{
 		pxNewTCB->uxBasePriority = uxPriority;
 		pxNewTCB->uxMutexesHeld = 0;
+		vListInitialise( &( pxNewTCB->xMutexesHeldList ) );
+		pxNewTCB->pxBlockedOnMutex = NULL;
 	}
 	#endif /* configUSE_MUTEXES */
 
+	// [ILG]
+	#if ( configUSE_QUEUE_HANDOFF == 1 )
+	{
+		pxNewTCB->pvHandoffBuffer = NULL;
+	}
+	#endif
+
+	#if ( configUSE_MULTI_WAIT == 1 )
+	{
+		pxNewTCB->pxWaitObjects = NULL;
+		pxNewTCB->uxWaitObjectCount = ( UBaseType_t ) 0U;
+		pxNewTCB->xWaitReadyIndex = -1;
+	}
+	#endif
+
+	#if ( configUSE_FULL_EVENT_BITS == 1 )
+	{
+		pxNewTCB->pvEventWaiter = NULL;
+	}
+	#endif
+
 	vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
 	vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
@@ -898,6 +1058,12 @@ UBaseType_t x;
 	}
 	#endif /* configUSE_APPLICATION_TASK_TAG */
 
+	#if ( configUSE_TASK_OBJECT_POINTER == 1 )
+	{
+		pxNewTCB->pvObject = NULL;
+	}
+	#endif /* configUSE_TASK_OBJECT_POINTER */
+
 	#if ( configGENERATE_RUN_TIME_STATS == 1 )
 	{
 		pxNewTCB->ulRunTimeCounter = 0UL;
@@ -926,8 +1092,12 @@ UBaseType_t x;
 
 	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 	{
-		pxNewTCB->ulNotifiedValue = 0;
-		pxNewTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+		// [ILG]
+		for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+		{
+			pxNewTCB->ulNotifiedValue[ x ] = 0;
+			pxNewTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
+		}
 	}
 	#endif
 
@@ -944,6 +1114,13 @@ UBaseType_t x;
 	}
 	#endif
 
+	#if ( configUSE_TASK_ITERATOR == 1 )
+	{
+		vListInitialiseItem( &( pxNewTCB->xRegistryListItem ) );
+		listSET_LIST_ITEM_OWNER( &( pxNewTCB->xRegistryListItem ), pxNewTCB );
+	}
+	#endif
+
 	/* Initialize the TCB stack to look as if the task was already running,
 	but had been interrupted by the scheduler.  The return address is set
 	to the start of the task function. Once the stack has been initialised
@@ -1026,6 +1203,14 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			pxNewTCB->uxTCBNumber = uxTaskNumber;
 		}
 		#endif /* configUSE_TRACE_FACILITY */
+
+		#if ( configUSE_TASK_ITERATOR == 1 )
+		{
+			/* Tasks are appended, so the registry remains sorted by
+			uxTCBNumber, which is what the iterator relies on. */
+			vListInsertEnd( &xTaskRegistryList, &( pxNewTCB->xRegistryListItem ) );
+		}
+		#endif /* configUSE_TASK_ITERATOR */
 		traceTASK_CREATE( pxNewTCB );
 
 		prvAddTaskToReadyList( pxNewTCB );
@@ -1086,12 +1271,37 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				mtCOVERAGE_TEST_MARKER();
 			}
 
+			#if ( configUSE_MUTEXES == 1 )
+			{
+				/* The holder of a mutex the task was waiting for might have
+				inherited its priority. */
+				prvStopWaitingForMutex( pxTCB );
+			}
+			#endif
+
+			// [ILG]
+			#if ( configUSE_MULTI_WAIT == 1 )
+			{
+				prvCancelMultiWait( pxTCB );
+			}
+			#endif
+
 			/* Increment the uxTaskNumber also so kernel aware debuggers can
 			detect that the task lists need re-generating.  This is done before
 			portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
 			not return. */
 			uxTaskNumber++;
 
+			#if ( configUSE_TASK_ITERATOR == 1 )
+			{
+				/* Remove the task from the registry now, even if the TCB is
+				freed later by the idle task, and let any iterator that might
+				be positioned on it know it must resynchronise. */
+				( void ) uxListRemove( &( pxTCB->xRegistryListItem ) );
+				uxTaskRegistryGeneration++;
+			}
+			#endif /* configUSE_TASK_ITERATOR */
+
 			if( pxTCB == pxCurrentTCB )
 			{
 				/* A task is deleting itself.  This cannot complete within the
@@ -1368,6 +1578,29 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 #endif /* INCLUDE_uxTaskPriorityGet */
 /*-----------------------------------------------------------*/
 
+// [ILG]
+#if ( ( INCLUDE_uxTaskPriorityGet == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+	UBaseType_t uxTaskBasePriorityGet( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxReturn;
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the base priority of the
+			calling task that is being queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			uxReturn = pxTCB->uxBasePriority;
+		}
+		taskEXIT_CRITICAL();
+
+		return uxReturn;
+	}
+
+#endif /* INCLUDE_uxTaskPriorityGet && configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( INCLUDE_uxTaskPriorityGet == 1 )
 
 	UBaseType_t uxTaskPriorityGetFromISR( TaskHandle_t xTask )
@@ -1494,19 +1727,11 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 
 				#if ( configUSE_MUTEXES == 1 )
 				{
-					/* Only change the priority being used if the task is not
-					currently using an inherited priority. */
-					if( pxTCB->uxBasePriority == pxTCB->uxPriority )
-					{
-						pxTCB->uxPriority = uxNewPriority;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-
-					/* The base priority gets set whatever. */
+					/* The base priority gets set whatever.  The priority being
+					used remains at least the priority inherited from the tasks
+					waiting for the mutexes the task holds. */
 					pxTCB->uxBasePriority = uxNewPriority;
+					pxTCB->uxPriority = prvGetInheritedPriority( pxTCB );
 				}
 				#else
 				{
@@ -1518,7 +1743,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				being used for anything else. */
 				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
 				{
-					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 				}
 				else
 				{
@@ -1552,6 +1777,22 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 					mtCOVERAGE_TEST_MARKER();
 				}
 
+				#if ( configUSE_MUTEXES == 1 )
+				{
+					/* If the task is waiting for a mutex then the holders along
+					the chain of mutexes might have to follow the new
+					priority. */
+					if( prvUpdateInheritedPriority( prvGetBlockingMutexHolder( pxTCB ) ) != pdFALSE )
+					{
+						xYieldRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
 				if( xYieldRequired != pdFALSE )
 				{
 					taskYIELD_IF_USING_PREEMPTION();
@@ -1607,6 +1848,21 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				mtCOVERAGE_TEST_MARKER();
 			}
 
+			#if ( configUSE_MUTEXES == 1 )
+			{
+				/* The holder of a mutex the task was waiting for might have
+				inherited its priority. */
+				prvStopWaitingForMutex( pxTCB );
+			}
+			#endif
+
+			// [ILG]
+			#if ( configUSE_MULTI_WAIT == 1 )
+			{
+				prvCancelMultiWait( pxTCB );
+			}
+			#endif
+
 			vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
 		}
 		taskEXIT_CRITICAL();
@@ -2399,109 +2655,301 @@ TCB_t *pxTCB;
 	}
 
 #endif /* configUSE_TRACE_FACILITY */
-/*----------------------------------------------------------*/
+/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+// [ILG]
+#if ( configUSE_TASK_ITERATOR == 1 )
 
-	TaskHandle_t xTaskGetIdleTaskHandle( void )
+	void vTaskIteratorInit( TaskIterator_t * const pxIterator )
 	{
-		/* If xTaskGetIdleTaskHandle() is called before the scheduler has been
-		started, then xIdleTaskHandle will be NULL. */
-		configASSERT( ( xIdleTaskHandle != NULL ) );
-		return xIdleTaskHandle;
-	}
-
-#endif /* INCLUDE_xTaskGetIdleTaskHandle */
-/*----------------------------------------------------------*/
-
-/* This conditional compilation should use inequality to 0, not equality to 1.
-This is to ensure vTaskStepTick() is available when user defined low power mode
-implementations require configUSE_TICKLESS_IDLE to be set to a value other than
-1. */
-#if ( configUSE_TICKLESS_IDLE != 0 )
+		configASSERT( pxIterator );
 
-	void vTaskStepTick( const TickType_t xTicksToJump )
-	{
-		/* Correct the tick count value after a period during which the tick
-		was suppressed.  Note this does *not* call the tick hook function for
-		each stepped tick. */
-		configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
-		xTickCount += xTicksToJump;
-		traceINCREASE_TICK_COUNT( xTicksToJump );
+		pxIterator->pvCursor = NULL;
+		pxIterator->uxLastTaskNumber = ( UBaseType_t ) 0U;
+		pxIterator->uxGeneration = ( UBaseType_t ) 0U;
 	}
 
-#endif /* configUSE_TICKLESS_IDLE */
-/*----------------------------------------------------------*/
+#endif /* configUSE_TASK_ITERATOR */
+/*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskAbortDelay == 1 )
+#if ( configUSE_TASK_ITERATOR == 1 )
 
-	BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
+	BaseType_t xTaskIteratorNext( TaskIterator_t * const pxIterator, TaskStatus_t * const pxTaskStatus, const BaseType_t xGetFreeStackSpace )
 	{
-	TCB_t *pxTCB = ( TCB_t * ) xTask;
+	ListItem_t *pxItem;
+	TCB_t *pxTCB;
 	BaseType_t xReturn = pdFALSE;
 
-		configASSERT( pxTCB );
+		configASSERT( pxIterator );
+		configASSERT( pxTaskStatus );
 
-		vTaskSuspendAll();
+		/* The stack scan takes time proportional to the unused stack, so it
+		is not done inside the critical section.  The scheduler is suspended
+		around both instead, so the task cannot be deleted, and its stack
+		freed, between the copy of its state and the scan. */
+		if( xGetFreeStackSpace != pdFALSE )
 		{
-			/* A task can only be prematurely removed from the Blocked state if
-			it is actually in the Blocked state. */
-			if( eTaskGetState( xTask ) == eBlocked )
-			{
-				/* Remove the reference to the task from the blocked list.  An
-				interrupt won't touch the xStateListItem because the
-				scheduler is suspended. */
-				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+			vTaskSuspendAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-				/* Is the task waiting on an event also?  If so remove it from
-				the event list too.  Interrupts can touch the event list item,
-				even though the scheduler is suspended, so a critical section
-				is used. */
-				taskENTER_CRITICAL();
+		/* Only one task is visited per call, and only for as long as it takes
+		to copy its state, so the scheduler and the interrupts are never held
+		off for a walk of the whole task population. */
+		taskENTER_CRITICAL();
+		{
+			if( ( pxIterator->pvCursor == NULL ) || ( pxIterator->uxGeneration != uxTaskRegistryGeneration ) )
+			{
+				/* First call, or a task was deleted since the previous call
+				and the cursor may reference a TCB that no longer exists.
+				The registry is sorted by TCB number, so resume from the first
+				task created after the one last reported.  This walk only
+				compares numbers and only happens after a deletion. */
+				pxItem = listGET_HEAD_ENTRY( &xTaskRegistryList );
+				while( pxItem != ( ListItem_t * ) listGET_END_MARKER( &xTaskRegistryList ) )
 				{
-					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-					{
-						( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-						pxTCB->ucDelayAborted = pdTRUE;
-					}
-					else
+					if( ( ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxItem ) )->uxTCBNumber > pxIterator->uxLastTaskNumber )
 					{
-						mtCOVERAGE_TEST_MARKER();
+						break;
 					}
+					pxItem = listGET_NEXT( pxItem );
 				}
-				taskEXIT_CRITICAL();
+				pxIterator->uxGeneration = uxTaskRegistryGeneration;
+			}
+			else
+			{
+				pxItem = listGET_NEXT( ( ListItem_t * ) pxIterator->pvCursor );
+			}
 
-				/* Place the unblocked task into the appropriate ready list. */
-				prvAddTaskToReadyList( pxTCB );
+			if( pxItem != ( ListItem_t * ) listGET_END_MARKER( &xTaskRegistryList ) )
+			{
+				pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxItem );
 
-				/* A task being unblocked cannot cause an immediate context
-				switch if preemption is turned off. */
-				#if (  configUSE_PREEMPTION == 1 )
+				pxTaskStatus->xHandle = ( TaskHandle_t ) pxTCB;
+				pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName[ 0 ] );
+				pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
+				pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
+				pxTaskStatus->pxStackBase = pxTCB->pxStack;
+
+				/* eTaskGetState() only nests a critical section, it never
+				suspends the scheduler, so it is safe to call from here. */
+				pxTaskStatus->eCurrentState = eTaskGetState( ( TaskHandle_t ) pxTCB );
+
+				#if ( configUSE_MUTEXES == 1 )
 				{
-					/* Preemption is on, but a context switch should only be
-					performed if the unblocked task has a priority that is
-					equal to or higher than the currently executing task. */
-					if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-					{
-						/* Pend the yield to be performed when the scheduler
-						is unsuspended. */
-						xYieldPending = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
 				}
-				#endif /* configUSE_PREEMPTION */
+				#else
+				{
+					pxTaskStatus->uxBasePriority = 0;
+				}
+				#endif
+
+				#if ( configGENERATE_RUN_TIME_STATS == 1 )
+				{
+					pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
+				}
+				#else
+				{
+					pxTaskStatus->ulRunTimeCounter = 0;
+				}
+				#endif
+
+				pxTaskStatus->usStackHighWaterMark = 0;
+
+				pxIterator->pvCursor = ( void * ) pxItem;
+				pxIterator->uxLastTaskNumber = pxTCB->uxTCBNumber;
+				xReturn = pdTRUE;
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		xTaskResumeAll();
+		taskEXIT_CRITICAL();
 
-		return xReturn;
+		if( xGetFreeStackSpace != pdFALSE )
+		{
+			if( xReturn != pdFALSE )
+			{
+				pxTCB = ( TCB_t * ) pxTaskStatus->xHandle;
+
+				#if ( portSTACK_GROWTH > 0 )
+				{
+					pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
+				}
+				#else
+				{
+					pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
+				}
+				#endif
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_ITERATOR */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_ITERATOR == 1 )
+
+	UBaseType_t uxTaskGetSystemStateIncremental( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime )
+	{
+	TaskIterator_t xIterator;
+	UBaseType_t uxTask = 0;
+
+		vTaskIteratorInit( &xIterator );
+
+		while( uxTask < uxArraySize )
+		{
+			if( xTaskIteratorNext( &xIterator, &( pxTaskStatusArray[ uxTask ] ), pdTRUE ) == pdFALSE )
+			{
+				break;
+			}
+			uxTask++;
+		}
+
+		#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		{
+			if( pulTotalRunTime != NULL )
+			{
+				#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+					portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
+				#else
+					*pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+				#endif
+			}
+		}
+		#else
+		{
+			if( pulTotalRunTime != NULL )
+			{
+				*pulTotalRunTime = 0;
+			}
+		}
+		#endif
+
+		return uxTask;
+	}
+
+#endif /* configUSE_TASK_ITERATOR */
+/*----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+
+	TaskHandle_t xTaskGetIdleTaskHandle( void )
+	{
+		/* If xTaskGetIdleTaskHandle() is called before the scheduler has been
+		started, then xIdleTaskHandle will be NULL. */
+		configASSERT( ( xIdleTaskHandle != NULL ) );
+		return xIdleTaskHandle;
+	}
+
+#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+/*----------------------------------------------------------*/
+
+/* This conditional compilation should use inequality to 0, not equality to 1.
+This is to ensure vTaskStepTick() is available when user defined low power mode
+implementations require configUSE_TICKLESS_IDLE to be set to a value other than
+1. */
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+	void vTaskStepTick( const TickType_t xTicksToJump )
+	{
+		/* Correct the tick count value after a period during which the tick
+		was suppressed.  Note this does *not* call the tick hook function for
+		each stepped tick. */
+		configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
+		xTickCount += xTicksToJump;
+		traceINCREASE_TICK_COUNT( xTicksToJump );
+	}
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskAbortDelay == 1 )
+
+	BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB = ( TCB_t * ) xTask;
+	BaseType_t xReturn = pdFALSE;
+
+		configASSERT( pxTCB );
+
+		vTaskSuspendAll();
+		{
+			/* A task can only be prematurely removed from the Blocked state if
+			it is actually in the Blocked state. */
+			if( eTaskGetState( xTask ) == eBlocked )
+			{
+				/* Remove the reference to the task from the blocked list.  An
+				interrupt won't touch the xStateListItem because the
+				scheduler is suspended. */
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+				/* Is the task waiting on an event also?  If so remove it from
+				the event list too.  Interrupts can touch the event list item,
+				even though the scheduler is suspended, so a critical section
+				is used. */
+				taskENTER_CRITICAL();
+				{
+					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+					{
+						( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+						pxTCB->ucDelayAborted = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				taskEXIT_CRITICAL();
+
+				/* Place the unblocked task into the appropriate ready list. */
+				prvAddTaskToReadyList( pxTCB );
+
+				/* A task being unblocked cannot cause an immediate context
+				switch if preemption is turned off. */
+				#if (  configUSE_PREEMPTION == 1 )
+				{
+					/* Preemption is on, but a context switch should only be
+					performed if the unblocked task has a priority that is
+					equal to or higher than the currently executing task. */
+					if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+					{
+						/* Pend the yield to be performed when the scheduler
+						is unsuspended. */
+						xYieldPending = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_PREEMPTION */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		xTaskResumeAll();
+
+		return xReturn;
 	}
 
 #endif /* INCLUDE_xTaskAbortDelay */
@@ -2618,6 +3066,23 @@ BaseType_t xSwitchRequired = pdFALSE;
 			}
 		}
 
+		// [ILG]
+		#if ( configUSE_TICK_TIMERS == 1 )
+		{
+			/* As with the tick hook, the pended ticks being unwound were
+			already processed when they occurred.  Tasks readied by the
+			callbacks set xYieldPending. */
+			if( uxPendedTicks == ( UBaseType_t ) 0U )
+			{
+				vTimerProcessTickTimers( xConstTickCount );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TICK_TIMERS */
+
 		/* Tasks of equal priority to the currently running task will share
 		processing time (time slice) if preemption is on, and the application
 		writer has not explicitly turned time slicing off. */
@@ -2653,6 +3118,14 @@ BaseType_t xSwitchRequired = pdFALSE;
 	{
 		++uxPendedTicks;
 
+		// [ILG]
+		#if ( configUSE_TICK_TIMERS == 1 )
+		{
+			/* Tick timers expire on time even if the scheduler is locked. */
+			vTimerProcessTickTimers( xTickCount + ( TickType_t ) uxPendedTicks );
+		}
+		#endif /* configUSE_TICK_TIMERS */
+
 		/* The tick hook gets called at regular intervals, even if the
 		scheduler is locked. */
 		#if ( configUSE_TICK_HOOK == 1 )
@@ -3015,6 +3488,67 @@ BaseType_t xReturn;
 }
 /*-----------------------------------------------------------*/
 
+// [ILG]
+#if( configUSE_EVENT_GROUP_DIRECT_ISR == 1 )
+
+	BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem, const TickType_t xItemValue )
+	{
+	TCB_t *pxUnblockedTCB;
+	BaseType_t xReturn;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
+		called from a critical section within an ISR.  It is used by the event
+		flags implementation, which only calls it while no task is accessing
+		the event list with the scheduler suspended. */
+
+		/* Store the new item value in the event list. */
+		listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+		pxUnblockedTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxEventListItem );
+		configASSERT( pxUnblockedTCB );
+		( void ) uxListRemove( pxEventListItem );
+
+		if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+		{
+			( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
+			prvAddTaskToReadyList( pxUnblockedTCB );
+		}
+		else
+		{
+			/* The delayed and ready lists cannot be accessed, so hold this task
+			pending until the scheduler is resumed.  The event list item keeps
+			the value stored above. */
+			vListInsertEnd( &( xPendingReadyList ), pxEventListItem );
+		}
+
+		if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+		{
+			xReturn = pdTRUE;
+
+			/* Mark that a yield is pending in case the user is not using the
+			"xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS
+			function. */
+			xYieldPending = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+
+		#if( configUSE_TICKLESS_IDLE != 0 )
+		{
+			/* As in xTaskRemoveFromEventList(), update the next unblock time so
+			sleep mode is entered at the earliest possible time. */
+			prvResetNextTaskUnblockTime();
+		}
+		#endif
+
+		return xReturn;
+	}
+
+#endif /* configUSE_EVENT_GROUP_DIRECT_ISR */
+/*-----------------------------------------------------------*/
+
 void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
 {
 	configASSERT( pxTimeOut );
@@ -3325,6 +3859,34 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 #endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
 /*-----------------------------------------------------------*/
 
+// [ILG]
+#if ( configUSE_TASK_OBJECT_POINTER == 1 )
+
+	void vTaskSetObjectPointer( TaskHandle_t xTask, void *pvObject )
+	{
+	TCB_t *pxTCB;
+
+		pxTCB = prvGetTCBFromHandle( xTask );
+		pxTCB->pvObject = pvObject;
+	}
+
+#endif /* configUSE_TASK_OBJECT_POINTER */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configUSE_TASK_OBJECT_POINTER == 1 )
+
+	void *pvTaskGetObjectPointer( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+
+		pxTCB = prvGetTCBFromHandle( xTask );
+		return pxTCB->pvObject;
+	}
+
+#endif /* configUSE_TASK_OBJECT_POINTER */
+/*-----------------------------------------------------------*/
+
 #if ( portUSING_MPU_WRAPPERS == 1 )
 
 	void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify, const MemoryRegion_t * const xRegions )
@@ -3366,6 +3928,12 @@ UBaseType_t uxPriority;
 	}
 	#endif /* INCLUDE_vTaskSuspend */
 
+	#if ( configUSE_TASK_ITERATOR == 1 )
+	{
+		vListInitialise( &xTaskRegistryList );
+	}
+	#endif /* configUSE_TASK_ITERATOR */
+
 	/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
 	using list2. */
 	pxDelayedTaskList = &xDelayedTaskList1;
@@ -3714,65 +4282,174 @@ TCB_t *pxTCB;
 
 #if ( configUSE_MUTEXES == 1 )
 
-	void vTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
+	static UBaseType_t prvGetInheritedPriority( const TCB_t * const pxTCB )
 	{
-	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
+	UBaseType_t uxPriority = pxTCB->uxBasePriority;
+	const ListItem_t *pxIterator;
+	const ListItem_t * const pxEndMarker = listGET_END_MARKER( &( pxTCB->xMutexesHeldList ) );
+	const MutexLink_t *pxMutexLink;
+	const TCB_t *pxWaitingTCB;
 
-		/* If the mutex was given back by an interrupt while the queue was
-		locked then the mutex holder might now be NULL. */
-		if( pxMutexHolder != NULL )
+		for( pxIterator = listGET_HEAD_ENTRY( &( pxTCB->xMutexesHeldList ) ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
 		{
-			/* If the holder of the mutex has a priority below the priority of
-			the task attempting to obtain the mutex then it will temporarily
-			inherit the priority of the task attempting to obtain the mutex. */
-			if( pxTCB->uxPriority < pxCurrentTCB->uxPriority )
+			/* The held list item is the first member of the mutex link. */
+			pxMutexLink = ( const MutexLink_t * ) pxIterator;
+
+			/* Immediate priority ceiling protocol - the holder runs at the
+			ceiling for as long as it holds the mutex. */
+			if( pxMutexLink->uxCeiling > uxPriority )
 			{
-				/* Adjust the mutex holder state to account for its new
-				priority.  Only reset the event list item value if the value is
-				not	being used for anything else. */
-				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
-				{
-					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				uxPriority = pxMutexLink->uxCeiling;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-				/* If the task being modified is in the ready state it will need
-				to be moved into a new list. */
-				if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
-				{
-					if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-					{
-						taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+			/* The waiting tasks are kept in priority order, so only the task
+			at the head of the list has to be considered. */
+			if( listLIST_IS_EMPTY( pxMutexLink->pxWaitingTasks ) == pdFALSE )
+			{
+				pxWaitingTCB = ( const TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxMutexLink->pxWaitingTasks );
 
-					/* Inherit the priority before being moved into the new list. */
-					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
-					prvAddTaskToReadyList( pxTCB );
+				if( pxWaitingTCB->uxPriority > uxPriority )
+				{
+					uxPriority = pxWaitingTCB->uxPriority;
 				}
 				else
 				{
-					/* Just inherit the priority. */
-					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
+					mtCOVERAGE_TEST_MARKER();
 				}
-
-				traceTASK_PRIORITY_INHERIT( pxTCB, pxCurrentTCB->uxPriority );
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		else
-		{
+
+		return uxPriority;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	static BaseType_t prvSetInheritedPriority( TCB_t * const pxTCB, UBaseType_t uxNewPriority )
+	{
+	BaseType_t xYieldRequired = pdFALSE;
+
+		if( uxNewPriority > pxTCB->uxPriority )
+		{
+			traceTASK_PRIORITY_INHERIT( pxTCB, uxNewPriority );
+
+			/* A ready task raised above the running task must run first. */
+			if( ( pxTCB != pxCurrentTCB ) && ( uxNewPriority > pxCurrentTCB->uxPriority ) )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			traceTASK_PRIORITY_DISINHERIT( pxTCB, uxNewPriority );
+
+			/* Lowering the running task may let another task run. */
+			if( pxTCB == pxCurrentTCB )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		/* Only reset the event list item value if the value is not being used
+		for anything else. */
+		if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+		{
+			listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* If the task being modified is in the ready state it will need to be
+		moved into a new list. */
+		if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+		{
+			if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+			{
+				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Change the priority before being moved into the new list. */
+			pxTCB->uxPriority = uxNewPriority;
+			prvAddTaskToReadyList( pxTCB );
+		}
+		else
+		{
+			/* Just change the priority, and do not yield for a task that
+			cannot run. */
+			pxTCB->uxPriority = uxNewPriority;
+
+			if( pxTCB != pxCurrentTCB )
+			{
+				xYieldRequired = pdFALSE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return xYieldRequired;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	static TCB_t *prvGetBlockingMutexHolder( TCB_t * const pxTCB )
+	{
+	MutexLink_t * const pxMutexLink = pxTCB->pxBlockedOnMutex;
+	TCB_t *pxHolderTCB = NULL;
+
+		/* The task is only still waiting if it is referenced from the list of
+		tasks waiting for the mutex; it might have been unblocked since. */
+		if( ( pxMutexLink != NULL ) && ( listIS_CONTAINED_WITHIN( pxMutexLink->pxWaitingTasks, &( pxTCB->xEventListItem ) ) != pdFALSE ) )
+		{
+			/* Re-insert the task so the list remains in priority order. */
+			( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+			vListInsert( pxMutexLink->pxWaitingTasks, &( pxTCB->xEventListItem ) );
+
+			/* The mutex might have been given and not yet taken by the task
+			that was unblocked. */
+			if( listLIST_ITEM_CONTAINER( &( pxMutexLink->xHeldListItem ) ) != NULL )
+			{
+				pxHolderTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( &( pxMutexLink->xHeldListItem ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
 			mtCOVERAGE_TEST_MARKER();
 		}
+
+		return pxHolderTCB;
 	}
 
 #endif /* configUSE_MUTEXES */
@@ -3780,13 +4457,106 @@ TCB_t *pxTCB;
 
 #if ( configUSE_MUTEXES == 1 )
 
-	BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder )
+	static BaseType_t prvUpdateInheritedPriority( TCB_t *pxTCB )
 	{
-	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
+	UBaseType_t uxNewPriority, uxSteps;
+	BaseType_t xYieldRequired = pdFALSE;
+
+		/* Each step changes the priority of one task, so bound the walk by the
+		number of tasks in case the application deadlocked on a cycle of
+		mutexes. */
+		for( uxSteps = uxCurrentNumberOfTasks; ( pxTCB != NULL ) && ( uxSteps > ( UBaseType_t ) 0 ); uxSteps-- )
+		{
+			uxNewPriority = prvGetInheritedPriority( pxTCB );
+
+			if( uxNewPriority == pxTCB->uxPriority )
+			{
+				/* Nothing further up the chain can change either. */
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( prvSetInheritedPriority( pxTCB, uxNewPriority ) != pdFALSE )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxTCB = prvGetBlockingMutexHolder( pxTCB );
+		}
+
+		return xYieldRequired;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	static void prvStopWaitingForMutex( TCB_t * const pxTCB )
+	{
+	MutexLink_t * const pxMutexLink = pxTCB->pxBlockedOnMutex;
+
+		if( pxMutexLink != NULL )
+		{
+			pxTCB->pxBlockedOnMutex = NULL;
+
+			if( listLIST_ITEM_CONTAINER( &( pxMutexLink->xHeldListItem ) ) != NULL )
+			{
+				( void ) prvUpdateInheritedPriority( ( TCB_t * ) listGET_LIST_ITEM_OWNER( &( pxMutexLink->xHeldListItem ) ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	void vTaskPriorityInherit( MutexLink_t * const pxMutexLink )
+	{
+		/* The calling task is already referenced from the list of tasks
+		waiting for the mutex.  If the mutex was given back by an interrupt
+		while the queue was locked then the mutex might not be held, in which
+		case there is nothing to inherit. */
+		pxCurrentTCB->pxBlockedOnMutex = pxMutexLink;
+
+		/* Raise the holder, then the holder of the mutex the holder is
+		waiting for, and so on. */
+		( void ) prvUpdateInheritedPriority( prvGetBlockingMutexHolder( pxCurrentTCB ) );
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	BaseType_t xTaskPriorityDisinherit( MutexLink_t * const pxMutexLink )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxNewPriority;
 	BaseType_t xReturn = pdFALSE;
 
-		if( pxMutexHolder != NULL )
+		/* The mutex is not held when it is given for the first time as it is
+		created. */
+		if( listLIST_ITEM_CONTAINER( &( pxMutexLink->xHeldListItem ) ) != NULL )
 		{
+			pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( &( pxMutexLink->xHeldListItem ) );
+
 			/* A task can only have an inherited priority if it holds the mutex.
 			If the mutex is held by a task then it cannot be given from an
 			interrupt, and if a mutex is given by the holding task then it must
@@ -3795,53 +4565,23 @@ TCB_t *pxTCB;
 
 			configASSERT( pxTCB->uxMutexesHeld );
 			( pxTCB->uxMutexesHeld )--;
+			( void ) uxListRemove( &( pxMutexLink->xHeldListItem ) );
 
-			/* Has the holder of the mutex inherited the priority of another
-			task? */
-			if( pxTCB->uxPriority != pxTCB->uxBasePriority )
-			{
-				/* Only disinherit if no other mutexes are held. */
-				if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
-				{
-					/* A task can only have an inherited priority if it holds
-					the mutex.  If the mutex is held by a task then it cannot be
-					given from an interrupt, and if a mutex is given by the
-					holding	task then it must be the running state task.  Remove
-					the	holding task from the ready	list. */
-					if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-					{
-						taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+			/* The task no longer inherits from the tasks waiting for this
+			mutex, but might still inherit from the tasks waiting for the other
+			mutexes it holds.  The running task is not waiting for a mutex, so
+			there is no chain to follow. */
+			uxNewPriority = prvGetInheritedPriority( pxTCB );
 
-					/* Disinherit the priority before adding the task into the
-					new	ready list. */
-					traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
-					pxTCB->uxPriority = pxTCB->uxBasePriority;
-
-					/* Reset the event list item value.  It cannot be in use for
-					any other purpose if this task is running, and it must be
-					running to give back the mutex. */
-					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-					prvAddTaskToReadyList( pxTCB );
+			if( uxNewPriority != pxTCB->uxPriority )
+			{
+				( void ) prvSetInheritedPriority( pxTCB, uxNewPriority );
 
-					/* Return true to indicate that a context switch is required.
-					This is only actually required in the corner case whereby
-					multiple mutexes were held and the mutexes were given back
-					in an order different to that in which they were taken.
-					If a context switch did not occur when the first mutex was
-					returned, even if a task was waiting on it, then a context
-					switch should occur when the last mutex is returned whether
-					a task is waiting on it or not. */
-					xReturn = pdTRUE;
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				/* Return true to indicate that a context switch is required.
+				This is required whether a task was waiting for this mutex or
+				not, as the priority being lowered might have been inherited
+				from a task waiting for a mutex given back earlier. */
+				xReturn = pdTRUE;
 			}
 			else
 			{
@@ -3859,6 +4599,26 @@ TCB_t *pxTCB;
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MUTEXES == 1 )
+
+	void vTaskPriorityDisinheritAfterTimeout( MutexLink_t * const pxMutexLink )
+	{
+		/* The calling task has already been removed from the list of tasks
+		waiting for the mutex, so only its priority contribution is left to
+		undo. */
+		if( pxCurrentTCB->pxBlockedOnMutex == pxMutexLink )
+		{
+			prvStopWaitingForMutex( pxCurrentTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( portCRITICAL_NESTING_IN_TCB == 1 )
 
 	void vTaskEnterCritical( void )
@@ -3996,13 +4756,26 @@ TCB_t *pxTCB;
 		if( pxTaskStatusArray != NULL )
 		{
 			/* Generate the (binary) data. */
-			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
+			#if ( configUSE_TASK_ITERATOR == 1 )
+			{
+				/* Collect the data one task at a time, without suspending
+				the scheduler for the whole walk. */
+				uxArraySize = uxTaskGetSystemStateIncremental( pxTaskStatusArray, uxArraySize, NULL );
+			}
+			#else
+			{
+				uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
+			}
+			#endif
 
 			/* Create a human readable table from the binary data. */
 			for( x = 0; x < uxArraySize; x++ )
 			{
 				switch( pxTaskStatusArray[ x ].eCurrentState )
 				{
+					// [ILG] The task iterator reports the calling task as
+					// running, which is displayed as ready.
+					case eRunning:
 					case eReady:		cStatus = tskREADY_CHAR;
 										break;
 
@@ -4097,7 +4870,17 @@ TCB_t *pxTCB;
 		if( pxTaskStatusArray != NULL )
 		{
 			/* Generate the (binary) data. */
-			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalTime );
+			#if ( configUSE_TASK_ITERATOR == 1 )
+			{
+				/* Collect the data one task at a time, without suspending
+				the scheduler for the whole walk. */
+				uxArraySize = uxTaskGetSystemStateIncremental( pxTaskStatusArray, uxArraySize, &ulTotalTime );
+			}
+			#else
+			{
+				uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalTime );
+			}
+			#endif
 
 			/* For percentage calculations. */
 			ulTotalTime /= 100UL;
@@ -4149,17 +4932,445 @@ TCB_t *pxTCB;
 						#endif
 					}
 
-					pcWriteBuffer += strlen( pcWriteBuffer );
+					pcWriteBuffer += strlen( pcWriteBuffer );
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
+			is 0 then vPortFree() will be #defined to nothing. */
+			vPortFree( pxTaskStatusArray );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+/*-----------------------------------------------------------*/
+
+TickType_t uxTaskResetEventItemValue( void )
+{
+TickType_t uxReturn;
+
+	uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+
+	/* Reset the event list item to its normal value - so it can be used with
+	queues and semaphores. */
+	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	void *pvTaskIncrementMutexHeldCount( MutexLink_t * const pxMutexLink )
+	{
+		/* If xSemaphoreCreateMutex() is called before any tasks have been created
+		then pxCurrentTCB will be NULL. */
+		if( pxCurrentTCB != NULL )
+		{
+			/* A task that takes a mutex must not have a base priority above
+			the priority ceiling of the mutex, if it has one. */
+			configASSERT( ( pxMutexLink->uxCeiling == tskIDLE_PRIORITY ) || ( pxCurrentTCB->uxBasePriority <= pxMutexLink->uxCeiling ) );
+
+			( pxCurrentTCB->uxMutexesHeld )++;
+			pxCurrentTCB->pxBlockedOnMutex = NULL;
+
+			listSET_LIST_ITEM_OWNER( &( pxMutexLink->xHeldListItem ), pxCurrentTCB );
+			vListInsertEnd( &( pxCurrentTCB->xMutexesHeldList ), &( pxMutexLink->xHeldListItem ) );
+
+			/* The calling task is raised to the priority ceiling of the mutex,
+			if any, and tasks still waiting for the mutex are now blocked by
+			the calling task, which must inherit their priority.  Raising the
+			priority of the running task never requires a context switch. */
+			( void ) prvUpdateInheritedPriority( pxCurrentTCB );
+		}
+
+		return pxCurrentTCB;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	void vTaskSetMutexHolder( MutexLink_t * const pxMutexLink, TaskHandle_t xHolder )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) xHolder;
+
+		if( listLIST_ITEM_CONTAINER( &( pxMutexLink->xHeldListItem ) ) == NULL )
+		{
+			( pxTCB->uxMutexesHeld )++;
+
+			listSET_LIST_ITEM_OWNER( &( pxMutexLink->xHeldListItem ), pxTCB );
+			vListInsertEnd( &( pxTCB->xMutexesHeldList ), &( pxMutexLink->xHeldListItem ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	BaseType_t xTaskUpdateMutexHolderPriority( MutexLink_t * const pxMutexLink )
+	{
+	BaseType_t xReturn = pdFALSE;
+
+		/* The priority ceiling of the mutex changed, so recompute the priority
+		of its holder, and of the holders further up the chain, now. */
+		if( listLIST_ITEM_CONTAINER( &( pxMutexLink->xHeldListItem ) ) != NULL )
+		{
+			xReturn = prvUpdateInheritedPriority( ( TCB_t * ) listGET_LIST_ITEM_OWNER( &( pxMutexLink->xHeldListItem ) ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	void vTaskClearMutexWait( void )
+	{
+		/* The calling task obtained the mutex it was waiting for, so must not
+		keep a link to it once the mutex can be deleted. */
+		pxCurrentTCB->pxBlockedOnMutex = NULL;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configUSE_QUEUE_HANDOFF == 1 )
+
+	void vTaskSetHandoffBuffer( void * const pvBuffer )
+	{
+		/* The calling task is not yet in an event list, so no sender can be
+		looking at the buffer. */
+		pxCurrentTCB->pvHandoffBuffer = pvBuffer;
+	}
+
+#endif /* configUSE_QUEUE_HANDOFF */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configUSE_QUEUE_HANDOFF == 1 )
+
+	void *pvTaskTakeHandoffBuffer( TaskHandle_t xTask )
+	{
+	TCB_t * const pxTCB = prvGetTCBFromHandle( xTask );
+	void *pvReturn;
+
+		pvReturn = pxTCB->pvHandoffBuffer;
+		pxTCB->pvHandoffBuffer = NULL;
+
+		return pvReturn;
+	}
+
+#endif /* configUSE_QUEUE_HANDOFF */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configUSE_FULL_EVENT_BITS == 1 )
+
+	void vTaskSetEventWaiter( void * const pvWaiter )
+	{
+		/* Set before the calling task is placed in an event list, and cleared
+		after it has been removed, so no other context is looking at it. */
+		pxCurrentTCB->pvEventWaiter = pvWaiter;
+	}
+
+#endif /* configUSE_FULL_EVENT_BITS */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configUSE_FULL_EVENT_BITS == 1 )
+
+	void *pvTaskGetEventWaiter( TaskHandle_t xTask )
+	{
+	TCB_t * const pxTCB = prvGetTCBFromHandle( xTask );
+
+		return pxTCB->pvEventWaiter;
+	}
+
+#endif /* configUSE_FULL_EVENT_BITS */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+
+	BaseType_t xTaskAdvanceTimeout( TaskHandle_t xTask, const TickType_t xTicksToWait )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) xTask;
+	const List_t *pxContainer;
+	TickType_t xTimeToWake;
+	BaseType_t xReturn = pdPASS;
+
+		configASSERT( pxTCB );
+
+		if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+		{
+			pxContainer = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
+
+			/* Tasks blocked indefinitely are in the suspended list, and are
+			left alone. */
+			if( ( pxContainer == pxDelayedTaskList ) || ( pxContainer == pxOverflowDelayedTaskList ) )
+			{
+				/* The unsigned subtraction gives the number of ticks left for
+				either list. */
+				if( xTicksToWait < ( TickType_t ) ( listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) - xTickCount ) )
+				{
+					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+					xTimeToWake = xTickCount + xTicksToWait;
+					listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), xTimeToWake );
+
+					if( xTimeToWake < xTickCount )
+					{
+						/* Wake time has overflowed.  Place this item in the
+						overflow list. */
+						vListInsert( pxOverflowDelayedTaskList, &( pxTCB->xStateListItem ) );
+					}
+					else
+					{
+						vListInsert( pxDelayedTaskList, &( pxTCB->xStateListItem ) );
+
+						if( xTimeToWake < xNextTaskUnblockTime )
+						{
+							xNextTaskUnblockTime = xTimeToWake;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TIMER_DIRECT_COMMANDS */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configUSE_MULTI_WAIT == 1 )
+
+	BaseType_t xTaskWaitForMultiple( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount, TickType_t xTicksToWait )
+	{
+	UBaseType_t ux;
+	WaitObject_t *pxObject;
+	BaseType_t xReady, xReturn = -1;
+
+		configASSERT( pxObjects );
+		configASSERT( uxObjectCount > ( UBaseType_t ) 0U );
+
+		/* Cannot block if the scheduler is suspended. */
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		taskENTER_CRITICAL();
+		{
+			pxCurrentTCB->pxWaitObjects = pxObjects;
+			pxCurrentTCB->uxWaitObjectCount = uxObjectCount;
+			pxCurrentTCB->xWaitReadyIndex = -1;
+
+			for( ux = ( UBaseType_t ) 0U; ux < uxObjectCount; ux++ )
+			{
+				vListInitialiseItem( &( pxObjects[ ux ].xWaiterListItem ) );
+			}
+
+			/* Link a waiter record into each object, stopping at the first
+			object that is already ready.  Everything is done in one critical
+			section, so no object can become ready unnoticed between checking it
+			and blocking. */
+			for( ux = ( UBaseType_t ) 0U; ux < uxObjectCount; ux++ )
+			{
+				pxObject = &( pxObjects[ ux ] );
+
+				listSET_LIST_ITEM_OWNER( &( pxObject->xWaiterListItem ), pxCurrentTCB );
+				listSET_LIST_ITEM_VALUE( &( pxObject->xWaiterListItem ), ( TickType_t ) ux );
+
+				switch( pxObject->eType )
+				{
+					case eWaitQueue:
+						xReady = xQueueAddMultiWaiter( ( QueueHandle_t ) pxObject->pvObject, &( pxObject->xWaiterListItem ) );
+						break;
+
+					case eWaitEventGroup:
+						xReady = xEventGroupAddMultiWaiter( ( EventGroupHandle_t ) pxObject->pvObject, &( pxObject->xWaiterListItem ), ( EventBits_t ) pxObject->ulBits );
+						break;
+
+					#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+						case eWaitNotification:
+							/* The notification code looks the record up through
+							the TCB, so nothing is linked. */
+							xReady = ( ( pxCurrentTCB->ulNotifiedValue[ tskDEFAULT_INDEX_TO_NOTIFY ] & pxObject->ulBits ) != 0UL ) ? pdTRUE : pdFALSE;
+							break;
+					#endif
+
+					default:
+						/* Should not get here. */
+						configASSERT( pdFALSE );
+						xReady = pdFALSE;
+						break;
+				}
+
+				if( xReady != pdFALSE )
+				{
+					pxCurrentTCB->xWaitReadyIndex = ( BaseType_t ) ux;
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+
+			if( ( pxCurrentTCB->xWaitReadyIndex < 0 ) && ( xTicksToWait > ( TickType_t ) 0 ) )
+			{
+				prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+
+				/* All ports are written to allow a yield in a critical
+				section (some will yield immediately, others wait until the
+				critical section exits) - but it is not something that
+				application code should ever do. */
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		taskENTER_CRITICAL();
+		{
+			/* Records left unlinked because an object was found ready first
+			still have no container. */
+			prvRemoveMultiWaitRecords( pxObjects, uxObjectCount );
+
+			xReturn = pxCurrentTCB->xWaitReadyIndex;
+			pxCurrentTCB->pxWaitObjects = NULL;
+			pxCurrentTCB->uxWaitObjectCount = ( UBaseType_t ) 0U;
+			pxCurrentTCB->xWaitReadyIndex = -1;
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTI_WAIT */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configUSE_MULTI_WAIT == 1 )
+
+	BaseType_t xTaskWakeMultiWaiters( const List_t * const pxWaiterList, const uint32_t ulBits )
+	{
+	const ListItem_t *pxIterator;
+	const ListItem_t * const pxEnd = listGET_END_MARKER( pxWaiterList );
+	const WaitObject_t *pxObject;
+	BaseType_t xReturn = pdFALSE;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also
+		be called from a critical section within an ISR.
+
+		Records stay linked until their task removes them, so the list is not
+		modified while it is walked. */
+		for( pxIterator = listGET_HEAD_ENTRY( pxWaiterList ); pxIterator != pxEnd; pxIterator = listGET_NEXT( pxIterator ) )
+		{
+			pxObject = ( const WaitObject_t * ) ( ( const void * ) ( ( const uint8_t * ) pxIterator - offsetof( WaitObject_t, xWaiterListItem ) ) );
+
+			if( ( pxObject->eType != eWaitEventGroup ) || ( ( pxObject->ulBits & ulBits ) != 0UL ) )
+			{
+				if( prvWakeMultiWaiter( ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator ), ( BaseType_t ) listGET_LIST_ITEM_VALUE( pxIterator ) ) != pdFALSE )
+				{
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
 				}
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
+		}
 
-			/* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
-			is 0 then vPortFree() will be #defined to nothing. */
-			vPortFree( pxTaskStatusArray );
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTI_WAIT */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configUSE_MULTI_WAIT == 1 )
+
+	static void prvRemoveMultiWaitRecords( WaitObject_t * const pxObjects, const UBaseType_t uxObjectCount )
+	{
+	UBaseType_t ux;
+
+		for( ux = ( UBaseType_t ) 0U; ux < uxObjectCount; ux++ )
+		{
+			if( listLIST_ITEM_CONTAINER( &( pxObjects[ ux ].xWaiterListItem ) ) != NULL )
+			{
+				( void ) uxListRemove( &( pxObjects[ ux ].xWaiterListItem ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+
+#endif /* configUSE_MULTI_WAIT */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configUSE_MULTI_WAIT == 1 )
+
+	static void prvCancelMultiWait( TCB_t * const pxTCB )
+	{
+		if( pxTCB->pxWaitObjects != NULL )
+		{
+			/* Nothing can wake the task once its records are unlinked, and it
+			returns -1 if it ever runs again. */
+			prvRemoveMultiWaitRecords( pxTCB->pxWaitObjects, pxTCB->uxWaitObjectCount );
+			pxTCB->pxWaitObjects = NULL;
+			pxTCB->uxWaitObjectCount = ( UBaseType_t ) 0U;
 		}
 		else
 		{
@@ -4167,53 +5378,115 @@ TCB_t *pxTCB;
 		}
 	}
 
-#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+#endif /* configUSE_MULTI_WAIT */
 /*-----------------------------------------------------------*/
 
-TickType_t uxTaskResetEventItemValue( void )
-{
-TickType_t uxReturn;
+// [ILG]
+#if ( configUSE_MULTI_WAIT == 1 )
 
-	uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+	static BaseType_t prvWakeMultiWaiter( TCB_t * const pxTCB, const BaseType_t xIndex )
+	{
+	BaseType_t xReturn = pdFALSE;
 
-	/* Reset the event list item to its normal value - so it can be used with
-	queues and semaphores. */
-	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		/* Only the first object to become ready wakes the task.  The task may
+		also already be ready, made so by a time out or by xTaskAbortDelay(),
+		but not yet have run to unlink its records. */
+		if( ( pxTCB->xWaitReadyIndex < 0 ) && ( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL ) && ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) == pdFALSE ) )
+		{
+			pxTCB->xWaitReadyIndex = xIndex;
 
-	return uxReturn;
-}
+			if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+			{
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+				prvAddTaskToReadyList( pxTCB );
+			}
+			else
+			{
+				/* The delayed and ready lists cannot be accessed, so hold this
+				task pending until the scheduler is resumed. */
+				vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+			}
+
+			if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+			{
+				/* Mark that a yield is pending in case the caller does not
+				act on the returned value. */
+				xYieldPending = pdTRUE;
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			#if( configUSE_TICKLESS_IDLE != 0 )
+			{
+				/* As in xTaskRemoveFromEventList(), update the next unblock
+				time so sleep mode is entered at the earliest possible time. */
+				prvResetNextTaskUnblockTime();
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTI_WAIT */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+// [ILG]
+#if ( ( configUSE_MULTI_WAIT == 1 ) && ( configUSE_TASK_NOTIFICATIONS == 1 ) )
 
-	void *pvTaskIncrementMutexHeldCount( void )
+	static BaseType_t prvNotifyMultiWaiter( TCB_t * const pxTCB )
 	{
-		/* If xSemaphoreCreateMutex() is called before any tasks have been created
-		then pxCurrentTCB will be NULL. */
-		if( pxCurrentTCB != NULL )
+	UBaseType_t ux;
+	BaseType_t xReturn = pdFALSE;
+
+		if( pxTCB->pxWaitObjects != NULL )
 		{
-			( pxCurrentTCB->uxMutexesHeld )++;
+			for( ux = ( UBaseType_t ) 0U; ux < pxTCB->uxWaitObjectCount; ux++ )
+			{
+				if( ( pxTCB->pxWaitObjects[ ux ].eType == eWaitNotification ) && ( ( pxTCB->ulNotifiedValue[ tskDEFAULT_INDEX_TO_NOTIFY ] & pxTCB->pxWaitObjects[ ux ].ulBits ) != 0UL ) )
+				{
+					xReturn = prvWakeMultiWaiter( pxTCB, ( BaseType_t ) ux );
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
 
-		return pxCurrentTCB;
+		return xReturn;
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* configUSE_MULTI_WAIT */
 /*-----------------------------------------------------------*/
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
+	uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWaitOn, BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
 	{
 	uint32_t ulReturn;
 
+		configASSERT( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES ); // [ILG]
+
 		taskENTER_CRITICAL();
 		{
 			/* Only block if the notification count is not already non-zero. */
-			if( pxCurrentTCB->ulNotifiedValue == 0UL )
+			if( pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] == 0UL )
 			{
 				/* Mark this task as waiting for a notification. */
-				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
+				pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskWAITING_NOTIFICATION;
 
 				if( xTicksToWait > ( TickType_t ) 0 )
 				{
@@ -4241,17 +5514,17 @@ TickType_t uxReturn;
 		taskENTER_CRITICAL();
 		{
 			traceTASK_NOTIFY_TAKE();
-			ulReturn = pxCurrentTCB->ulNotifiedValue;
+			ulReturn = pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ];
 
 			if( ulReturn != 0UL )
 			{
 				if( xClearCountOnExit != pdFALSE )
 				{
-					pxCurrentTCB->ulNotifiedValue = 0UL;
+					pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] = 0UL;
 				}
 				else
 				{
-					pxCurrentTCB->ulNotifiedValue = ulReturn - 1;
+					pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] = ulReturn - 1;
 				}
 			}
 			else
@@ -4259,7 +5532,7 @@ TickType_t uxReturn;
 				mtCOVERAGE_TEST_MARKER();
 			}
 
-			pxCurrentTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+			pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskNOT_WAITING_NOTIFICATION;
 		}
 		taskEXIT_CRITICAL();
 
@@ -4271,22 +5544,24 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait )
+	BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait )
 	{
 	BaseType_t xReturn;
 
+		configASSERT( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES ); // [ILG]
+
 		taskENTER_CRITICAL();
 		{
 			/* Only block if a notification is not already pending. */
-			if( pxCurrentTCB->ucNotifyState != taskNOTIFICATION_RECEIVED )
+			if( pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] != taskNOTIFICATION_RECEIVED )
 			{
 				/* Clear bits in the task's notification value as bits may get
 				set	by the notifying task or interrupt.  This can be used to
 				clear the value to zero. */
-				pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnEntry;
+				pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] &= ~ulBitsToClearOnEntry;
 
 				/* Mark this task as waiting for a notification. */
-				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
+				pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskWAITING_NOTIFICATION;
 
 				if( xTicksToWait > ( TickType_t ) 0 )
 				{
@@ -4319,14 +5594,14 @@ TickType_t uxReturn;
 			{
 				/* Output the current notification value, which may or may not
 				have changed. */
-				*pulNotificationValue = pxCurrentTCB->ulNotifiedValue;
+				*pulNotificationValue = pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ];
 			}
 
 			/* If ucNotifyValue is set then either the task never entered the
 			blocked state (because a notification was already pending) or the
 			task unblocked because of a notification.  Otherwise the task
 			unblocked because of a timeout. */
-			if( pxCurrentTCB->ucNotifyState == taskWAITING_NOTIFICATION )
+			if( pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] == taskWAITING_NOTIFICATION )
 			{
 				/* A notification was not received. */
 				xReturn = pdFALSE;
@@ -4335,11 +5610,11 @@ TickType_t uxReturn;
 			{
 				/* A notification was already pending or a notification was
 				received while the task was waiting. */
-				pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnExit;
+				pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] &= ~ulBitsToClearOnExit;
 				xReturn = pdTRUE;
 			}
 
-			pxCurrentTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+			pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskNOT_WAITING_NOTIFICATION;
 		}
 		taskEXIT_CRITICAL();
 
@@ -4351,44 +5626,45 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue )
+	BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue )
 	{
 	TCB_t * pxTCB;
 	BaseType_t xReturn = pdPASS;
 	uint8_t ucOriginalNotifyState;
 
 		configASSERT( xTaskToNotify );
+		configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES ); // [ILG]
 		pxTCB = ( TCB_t * ) xTaskToNotify;
 
 		taskENTER_CRITICAL();
 		{
 			if( pulPreviousNotificationValue != NULL )
 			{
-				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue;
+				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
 			}
 
-			ucOriginalNotifyState = pxTCB->ucNotifyState;
+			ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
 
-			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
+			pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
 			switch( eAction )
 			{
 				case eSetBits	:
-					pxTCB->ulNotifiedValue |= ulValue;
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
 					break;
 
 				case eIncrement	:
-					( pxTCB->ulNotifiedValue )++;
+					( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
 					break;
 
 				case eSetValueWithOverwrite	:
-					pxTCB->ulNotifiedValue = ulValue;
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
 					break;
 
 				case eSetValueWithoutOverwrite :
 					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
 					{
-						pxTCB->ulNotifiedValue = ulValue;
+						pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
 					}
 					else
 					{
@@ -4405,6 +5681,12 @@ TickType_t uxReturn;
 
 			traceTASK_NOTIFY();
 
+			#if( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+			{
+				ucOriginalNotifyState = prvCheckNotifyWaitBits( pxTCB, uxIndexToNotify, ucOriginalNotifyState );
+			}
+			#endif
+
 			/* If the task is in the blocked state specifically to wait for a
 			notification then unblock it now. */
 			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
@@ -4442,6 +5724,15 @@ TickType_t uxReturn;
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
+			#if ( configUSE_MULTI_WAIT == 1 )
+			else if( ( uxIndexToNotify == tskDEFAULT_INDEX_TO_NOTIFY ) && ( prvNotifyMultiWaiter( pxTCB ) != pdFALSE ) )
+			{
+				/* The task was blocked in xTaskWaitForMultiple() on a set of
+				notification bits that now has a bit set, and has a priority
+				above the currently executing task. */
+				taskYIELD_IF_USING_PREEMPTION();
+			}
+			#endif
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
@@ -4457,7 +5748,7 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken )
+	BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken )
 	{
 	TCB_t * pxTCB;
 	uint8_t ucOriginalNotifyState;
@@ -4465,6 +5756,7 @@ TickType_t uxReturn;
 	UBaseType_t uxSavedInterruptStatus;
 
 		configASSERT( xTaskToNotify );
+		configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES ); // [ILG]
 
 		/* RTOS ports that support interrupt nesting have the concept of a
 		maximum	system call (or maximum API call) interrupt priority.
@@ -4490,30 +5782,30 @@ TickType_t uxReturn;
 		{
 			if( pulPreviousNotificationValue != NULL )
 			{
-				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue;
+				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
 			}
 
-			ucOriginalNotifyState = pxTCB->ucNotifyState;
-			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
+			ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+			pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
 			switch( eAction )
 			{
 				case eSetBits	:
-					pxTCB->ulNotifiedValue |= ulValue;
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
 					break;
 
 				case eIncrement	:
-					( pxTCB->ulNotifiedValue )++;
+					( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
 					break;
 
 				case eSetValueWithOverwrite	:
-					pxTCB->ulNotifiedValue = ulValue;
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
 					break;
 
 				case eSetValueWithoutOverwrite :
 					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
 					{
-						pxTCB->ulNotifiedValue = ulValue;
+						pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
 					}
 					else
 					{
@@ -4530,6 +5822,12 @@ TickType_t uxReturn;
 
 			traceTASK_NOTIFY_FROM_ISR();
 
+			#if( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+			{
+				ucOriginalNotifyState = prvCheckNotifyWaitBits( pxTCB, uxIndexToNotify, ucOriginalNotifyState );
+			}
+			#endif
+
 			/* If the task is in the blocked state specifically to wait for a
 			notification then unblock it now. */
 			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
@@ -4570,6 +5868,18 @@ TickType_t uxReturn;
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
+			#if ( configUSE_MULTI_WAIT == 1 )
+			else if( ( uxIndexToNotify == tskDEFAULT_INDEX_TO_NOTIFY ) && ( prvNotifyMultiWaiter( pxTCB ) != pdFALSE ) )
+			{
+				/* The task was blocked in xTaskWaitForMultiple() on a set of
+				notification bits that now has a bit set, and has a priority
+				above the currently executing task. */
+				if( pxHigherPriorityTaskWoken != NULL )
+				{
+					*pxHigherPriorityTaskWoken = pdTRUE;
+				}
+			}
+			#endif
 		}
 		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
@@ -4581,13 +5891,14 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken )
+	void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, BaseType_t *pxHigherPriorityTaskWoken )
 	{
 	TCB_t * pxTCB;
 	uint8_t ucOriginalNotifyState;
 	UBaseType_t uxSavedInterruptStatus;
 
 		configASSERT( xTaskToNotify );
+		configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES ); // [ILG]
 
 		/* RTOS ports that support interrupt nesting have the concept of a
 		maximum	system call (or maximum API call) interrupt priority.
@@ -4611,15 +5922,21 @@ TickType_t uxReturn;
 
 		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 		{
-			ucOriginalNotifyState = pxTCB->ucNotifyState;
-			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
+			ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+			pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
 			/* 'Giving' is equivalent to incrementing a count in a counting
 			semaphore. */
-			( pxTCB->ulNotifiedValue )++;
+			( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
 
 			traceTASK_NOTIFY_GIVE_FROM_ISR();
 
+			#if( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+			{
+				ucOriginalNotifyState = prvCheckNotifyWaitBits( pxTCB, uxIndexToNotify, ucOriginalNotifyState );
+			}
+			#endif
+
 			/* If the task is in the blocked state specifically to wait for a
 			notification then unblock it now. */
 			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
@@ -4660,6 +5977,18 @@ TickType_t uxReturn;
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
+			#if ( configUSE_MULTI_WAIT == 1 )
+			else if( ( uxIndexToNotify == tskDEFAULT_INDEX_TO_NOTIFY ) && ( prvNotifyMultiWaiter( pxTCB ) != pdFALSE ) )
+			{
+				/* The task was blocked in xTaskWaitForMultiple() on a set of
+				notification bits that now has a bit set, and has a priority
+				above the currently executing task. */
+				if( pxHigherPriorityTaskWoken != NULL )
+				{
+					*pxHigherPriorityTaskWoken = pdTRUE;
+				}
+			}
+			#endif
 		}
 		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 	}
@@ -4670,20 +5999,22 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask )
+	BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear )
 	{
 	TCB_t *pxTCB;
 	BaseType_t xReturn;
 
+		configASSERT( uxIndexToClear < configTASK_NOTIFICATION_ARRAY_ENTRIES ); // [ILG]
+
 		/* If null is passed in here then it is the calling task that is having
 		its notification state cleared. */
 		pxTCB = prvGetTCBFromHandle( xTask );
 
 		taskENTER_CRITICAL();
 		{
-			if( pxTCB->ucNotifyState == taskNOTIFICATION_RECEIVED )
+			if( pxTCB->ucNotifyState[ uxIndexToClear ] == taskNOTIFICATION_RECEIVED )
 			{
-				pxTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+				pxTCB->ucNotifyState[ uxIndexToClear ] = taskNOT_WAITING_NOTIFICATION;
 				xReturn = pdPASS;
 			}
 			else
@@ -4699,6 +6030,161 @@ TickType_t uxReturn;
 #endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
+// [ILG]
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	uint32_t ulTaskGenericNotifyValueClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear, uint32_t ulBitsToClear )
+	{
+	TCB_t *pxTCB;
+	uint32_t ulReturn;
+
+		configASSERT( uxIndexToClear < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+		/* If null is passed in here then it is the calling task that is having
+		its notification value cleared. */
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		taskENTER_CRITICAL();
+		{
+			ulReturn = pxTCB->ulNotifiedValue[ uxIndexToClear ];
+			pxTCB->ulNotifiedValue[ uxIndexToClear ] &= ~ulBitsToClear;
+		}
+		taskEXIT_CRITICAL();
+
+		return ulReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+
+	static uint8_t prvCheckNotifyWaitBits( TCB_t * const pxTCB, const UBaseType_t uxIndex, const uint8_t ucOriginalNotifyState )
+	{
+	uint32_t ulBits;
+	uint8_t ucReturn = ucOriginalNotifyState;
+
+		if( ( ucOriginalNotifyState == taskWAITING_NOTIFICATION_ANY ) || ( ucOriginalNotifyState == taskWAITING_NOTIFICATION_ALL ) )
+		{
+			ulBits = pxTCB->ulNotifiedValue[ uxIndex ] & pxTCB->ulNotifyWaitBits;
+
+			if( ( ( ucOriginalNotifyState == taskWAITING_NOTIFICATION_ANY ) && ( ulBits != 0UL ) ) ||
+				( ( ucOriginalNotifyState == taskWAITING_NOTIFICATION_ALL ) && ( ulBits == pxTCB->ulNotifyWaitBits ) ) )
+			{
+				/* The condition is met, the task is unblocked exactly as if
+				it was waiting in xTaskNotifyWait(). */
+				ucReturn = taskWAITING_NOTIFICATION;
+			}
+			else
+			{
+				/* Keep waiting.  The value has been updated, so the bits are
+				not lost, but the task is not woken for them. */
+				pxTCB->ucNotifyState[ uxIndex ] = ucOriginalNotifyState;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ucReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFY_WAIT_BITS */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if( configUSE_TASK_NOTIFY_WAIT_BITS == 1 )
+
+	BaseType_t xTaskGenericNotifyWaitBits( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToWaitFor, BaseType_t xClearOnExit, BaseType_t xWaitForAllBits, uint32_t *pulNotificationValue, TickType_t xTicksToWait )
+	{
+	BaseType_t xReturn;
+	uint32_t ulValue;
+
+		configASSERT( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+		configASSERT( ulBitsToWaitFor != 0UL );
+
+		taskENTER_CRITICAL();
+		{
+			ulValue = pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] & ulBitsToWaitFor;
+
+			/* Only block if the condition is not already met. */
+			if( ( ( xWaitForAllBits == pdFALSE ) && ( ulValue == 0UL ) ) ||
+				( ( xWaitForAllBits != pdFALSE ) && ( ulValue != ulBitsToWaitFor ) ) )
+			{
+				/* Notifications are tested against the bits before the task
+				is unblocked, see prvCheckNotifyWaitBits(). */
+				pxCurrentTCB->ulNotifyWaitBits = ulBitsToWaitFor;
+				pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = ( xWaitForAllBits == pdFALSE ) ? taskWAITING_NOTIFICATION_ANY : taskWAITING_NOTIFICATION_ALL;
+
+				if( xTicksToWait > ( TickType_t ) 0 )
+				{
+					prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+					traceTASK_NOTIFY_WAIT_BLOCK();
+
+					/* All ports are written to allow a yield in a critical
+					section (some will yield immediately, others wait until the
+					critical section exits) - but it is not something that
+					application code should ever do. */
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		taskENTER_CRITICAL();
+		{
+			traceTASK_NOTIFY_WAIT();
+
+			ulValue = pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ];
+
+			if( pulNotificationValue != NULL )
+			{
+				*pulNotificationValue = ulValue;
+			}
+
+			/* Test the value again, rather than the state, as the task may
+			also have timed out after the bits were set. */
+			ulValue &= ulBitsToWaitFor;
+
+			if( ( ( xWaitForAllBits == pdFALSE ) && ( ulValue != 0UL ) ) ||
+				( ( xWaitForAllBits != pdFALSE ) && ( ulValue == ulBitsToWaitFor ) ) )
+			{
+				if( xClearOnExit != pdFALSE )
+				{
+					pxCurrentTCB->ulNotifiedValue[ uxIndexToWaitOn ] &= ~ulBitsToWaitFor;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				xReturn = pdFALSE;
+			}
+
+			pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskNOT_WAITING_NOTIFICATION;
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFY_WAIT_BITS */
+/*-----------------------------------------------------------*/
+
 
 static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseType_t xCanBlockIndefinitely )
 {
@@ -4908,6 +6394,20 @@ const TickType_t xConstTickCount = xTickCount;
         mtCOVERAGE_TEST_MARKER();
       }
 
+#if ( configUSE_MUTEXES == 1 )
+      {
+        /* The holder of a mutex the task was waiting for might have
+         inherited its priority. */
+        prvStopWaitingForMutex( pxTCB );
+      }
+#endif
+
+#if ( configUSE_MULTI_WAIT == 1 )
+      {
+        prvCancelMultiWait( pxTCB );
+      }
+#endif
+
       vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
     }
     // taskEXIT_CRITICAL();
@@ -84,6 +84,11 @@ task.h is included from an application file. */
 	#error configUSE_TIMERS must be set to 1 to make the xTimerPendFunctionCall() function available.
 #endif
 
+// [ILG]
+#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 ) && ( configUSE_TIMERS == 0 )
+	#error configUSE_TIMERS must be set to 1 to make the xTimerGenericCommandDirect() function available.
+#endif
+
 /* Lint e961 and e750 are suppressed as a MISRA exception justified because the
 MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
 header files above, but not in this file, in order to generate the correct
@@ -100,6 +105,57 @@ configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */
 /* Misc definitions. */
 #define tmrNO_DELAY		( TickType_t ) 0U
 
+// [ILG]
+/* When xTimerGenericCommandDirect() updates the lists of active timers from
+other tasks and from interrupts, the timer service task only accesses them from
+critical sections. */
+#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+	#define tmrENTER_LIST_CRITICAL()	taskENTER_CRITICAL()
+	#define tmrEXIT_LIST_CRITICAL()		taskEXIT_CRITICAL()
+#else
+	#define tmrENTER_LIST_CRITICAL()
+	#define tmrEXIT_LIST_CRITICAL()
+#endif
+
+// [ILG]
+/* With configUSE_TIMER_WHEEL active timers are held in a hierarchical timing
+wheel.  Each level has tmrWHEEL_SLOTS slots, and each slot of level n covers
+tmrWHEEL_SLOTS^n ticks.  Timers that expire further in the future than the
+last level covers are held in a separate list. */
+#if ( configUSE_TIMER_WHEEL == 1 )
+	#define tmrWHEEL_SLOT_BITS		( 5U )
+	#define tmrWHEEL_SLOTS			( 1U << tmrWHEEL_SLOT_BITS )
+	#define tmrWHEEL_SLOT_MASK		( tmrWHEEL_SLOTS - 1U )
+
+	/* The number of ticks covered by one slot of level uxLevel. */
+	#define tmrWHEEL_LEVEL_TICKS( uxLevel )	( ( TickType_t ) 1U << ( ( uxLevel ) * tmrWHEEL_SLOT_BITS ) )
+
+	/* The slot of level uxLevel that holds the time xTime. */
+	#define tmrWHEEL_SLOT( xTime, uxLevel )	( ( UBaseType_t ) ( ( xTime ) >> ( ( uxLevel ) * tmrWHEEL_SLOT_BITS ) ) & tmrWHEEL_SLOT_MASK )
+
+	/* Wrap safe comparison of two tick counts that are less than half the
+	tick count range apart. */
+	#define tmrTIME_REACHED( xTime, xTimeNow )	( ( TickType_t ) ( ( xTimeNow ) - ( xTime ) ) <= ( portMAX_DELAY >> 1U ) )
+
+	#if( configTIMER_WHEEL_LEVELS < 1 )
+		#error configTIMER_WHEEL_LEVELS must be at least 1.
+	#endif
+
+	#if( ( configUSE_16_BIT_TICKS == 1 ) && ( configTIMER_WHEEL_LEVELS > 3 ) )
+		#error configTIMER_WHEEL_LEVELS must not be more than 3 with 16 bit ticks.
+	#endif
+
+	#if( configTIMER_WHEEL_LEVELS > 6 )
+		#error configTIMER_WHEEL_LEVELS must not be more than 6.
+	#endif
+#endif
+
+#if( ( configUSE_TICK_TIMERS == 1 ) && ( configTICK_TIMER_MAX_RUN_TIME > 0 ) && ( configGENERATE_RUN_TIME_STATS == 0 ) )
+	/* The run time of tick timer callbacks is measured with the run time
+	stats counter. */
+	#error configTICK_TIMER_MAX_RUN_TIME requires configGENERATE_RUN_TIME_STATS to be set to 1.
+#endif
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl
 {
@@ -116,6 +172,18 @@ typedef struct tmrTimerControl
 	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 		uint8_t 			ucStaticallyAllocated; /*<< Set to pdTRUE if the timer was created statically so no attempt is made to free the memory again if the timer is later deleted. */
 	#endif
+
+	// [ILG]
+	#if( configUSE_TICK_TIMERS == 1 )
+		uint8_t 			ucTickContext;		/*<< Set to pdTRUE if the callback is called from the tick interrupt instead of from the timer service task. */
+	#endif
+	#if( configTIMER_SERVICE_COUNT > 1 )
+		UBaseType_t			uxTimerService;		/*<< The index of the timer service task that processes the timer. */
+		UBaseType_t			uxCommandsPending;	/*<< The number of commands sent to the queue of that task and not processed yet, so the timer is not moved to another task while there are any. */
+	#endif
+	#if( configUSE_TIMER_SLACK == 1 )
+		TickType_t			xTimerSlack;		/*<< How many ticks after its expiry time the callback can be called, so it is called together with the callbacks of other timers. */
+	#endif
 } xTIMER;
 
 /* The old xTIMER name is maintained above then typedefed to the new Timer_t
@@ -158,20 +226,108 @@ typedef struct tmrTimerQueueMessage
 	} u;
 } DaemonTaskMessage_t;
 
+// [ILG]
+/* The state of a timer service task.  There are configTIMER_SERVICE_COUNT of
+them, each with its own lists of active timers and command queue. */
+typedef struct tmrTimerService
+{
+	/* The list in which active timers are stored.  Timers are referenced in
+	expire time order, with the nearest expiry time at the front of the list.
+	Only the timer service task is allowed to access these lists, unless
+	configUSE_TIMER_DIRECT_COMMANDS is set to 1. */
+	List_t xActiveTimerList1;
+	List_t xActiveTimerList2;
+	List_t *pxCurrentTimerList;
+	List_t *pxOverflowTimerList;
+
+	/* The tick count when the timer service task last checked it for an
+	overflow, see prvSampleTimeNow(). */
+	TickType_t xLastTime;
+
+	#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+
+		/* Set by xTimerGenericCommandDirect() when a timer is placed at the
+		front of the current list, so the timer service task does not block
+		until the expiry time it read before. */
+		volatile BaseType_t xActiveListHeadChanged;
+
+		#if ( ( configUSE_TIMER_SLACK == 1 ) && ( configUSE_TIMER_WHEEL == 0 ) )
+
+			/* The time the timer service task last blocked until, which
+			with slack can be after the expiry time at the front of the
+			current list. */
+			TickType_t xWakeTime;
+
+		#endif
+
+	#endif
+
+	#if ( configUSE_TIMER_WHEEL == 1 )
+
+		/* The slots of the timing wheel, and the list of timers that expire
+		beyond the last level.  Timers are not sorted within a slot.  A bit is
+		set in ulWheelSlotsInUse[] for each slot that is not empty. */
+		List_t xTimerWheel[ configTIMER_WHEEL_LEVELS ][ tmrWHEEL_SLOTS ];
+		List_t xTimerWheelFarList;
+		uint32_t ulWheelSlotsInUse[ configTIMER_WHEEL_LEVELS ];
+		UBaseType_t uxTimersInWheel;
+
+		/* The next tick the wheel has to process.  Timers are placed in the
+		wheel relative to this time, so the tick count overflowing needs no
+		special handling. */
+		TickType_t xWheelNextTick;
+
+		#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+
+			/* The time the timer service task next has to process the wheel
+			at, as last calculated by prvGetNextExpireTime(), or the later
+			time it blocked until because of slack. */
+			TickType_t xWheelNextEvent;
+			BaseType_t xWheelNextEventValid;
+
+		#endif
+
+	#endif
+
+	/* A queue that is used to send commands to the timer service task. */
+	QueueHandle_t xTimerQueue;
+	TaskHandle_t xTimerTaskHandle;
+} TimerService_t;
+
+/* The timer service task that processes a timer. */
+#if ( configTIMER_SERVICE_COUNT > 1 )
+	#define tmrGET_SERVICE( pxTimer )	( &( xTimerServices[ ( pxTimer )->uxTimerService ] ) )
+#else
+	#define tmrGET_SERVICE( pxTimer )	( &( xTimerServices[ 0 ] ) )
+#endif
+
 /*lint -e956 A manual analysis and inspection has been used to determine which
 static variables must be declared volatile. */
 
-/* The list in which active timers are stored.  Timers are referenced in expire
-time order, with the nearest expiry time at the front of the list.  Only the
-timer service task is allowed to access these lists. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+/* The timer service tasks.  Service 0 is the one timers use by default, and
+the one pended functions are sent to. */
+PRIVILEGED_DATA static TimerService_t xTimerServices[ configTIMER_SERVICE_COUNT ]; // [ILG]
+
+/* The priority of each timer service task. */
+static const UBaseType_t uxTimerServicePriorities[ configTIMER_SERVICE_COUNT ] = configTIMER_SERVICE_PRIORITIES; // [ILG]
+
+// [ILG]
+#if ( configUSE_TICK_TIMERS == 1 )
+
+	/* The active timers whose callbacks are called from the tick interrupt,
+	in expiry time order.  As with the delayed task lists, timers that expire
+	after the tick count overflows are held in the second list.  They are only
+	accessed with interrupts masked. */
+	PRIVILEGED_DATA static List_t xTickTimerList1;
+	PRIVILEGED_DATA static List_t xTickTimerList2;
+	PRIVILEGED_DATA static List_t * volatile pxCurrentTickTimerList = NULL;
+	PRIVILEGED_DATA static List_t * volatile pxOverflowTickTimerList = NULL;
+
+	/* The tick last processed by vTimerProcessTickTimers().  Tick timers are
+	started relative to it. */
+	PRIVILEGED_DATA static volatile TickType_t xTickTimersTime = ( TickType_t ) 0U;
 
-/* A queue that is used to send commands to the timer service task. */
-PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
-PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
+#endif
 
 /*lint +e956 */
 
@@ -185,6 +341,15 @@ PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
 	and TCB. */
 	extern void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint32_t *pulTimerTaskStackSize );
 
+	// [ILG]
+	#if( ( configTIMER_SERVICE_COUNT > 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
+
+		/* Likewise for the timer service tasks other than the first one, if
+		they cannot be allocated dynamically.  uxService is 1 or more. */
+		extern void vApplicationGetTimerServiceTaskMemory( UBaseType_t uxService, StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint32_t *pulTimerTaskStackSize );
+
+	#endif
+
 #endif
 
 /*
@@ -204,7 +369,7 @@ static void prvTimerTask( void *pvParameters ) PRIVILEGED_FUNCTION;
  * Called by the timer service task to interpret and process a command it
  * received on the timer queue.
  */
-static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
+static void prvProcessReceivedCommands( TimerService_t * const pxService ) PRIVILEGED_FUNCTION;
 
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
@@ -212,23 +377,87 @@ static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
  */
 static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_TICK_TIMERS == 1 )
+
+	/*
+	 * [ILG] Apply a command to a timer whose callback is called from the tick
+	 * interrupt.  Returns pdFAIL for tmrCOMMAND_DELETE, which still has to be
+	 * sent to the timer service task to free the timer.
+	 */
+	static BaseType_t prvTickTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * [ILG] Insert the timer into the current or the overflow tick timer list.
+	 * Must be called with interrupts masked.
+	 */
+	static void prvInsertTickTimer( Timer_t * const pxTimer, const TickType_t xNextExpiryTime ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
- * An active timer has reached its expire time.  Reload the timer if it is an
- * auto reload timer, then call its callback.
+ * [ILG] Remove the timer from the list of active timers it is in.
  */
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+static void prvRemoveTimerFromActiveList( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+#if ( configTIMER_SERVICE_COUNT > 1 )
+
+	/*
+	 * [ILG] Count a command sent to the timer command queue for the timer when
+	 * xAdd is pdTRUE, or one that has been processed or could not be sent
+	 * when xAdd is pdFALSE.  See vTimerSetService().
+	 */
+	static void prvCountPendingCommand( Timer_t * const pxTimer, const BaseType_t xFromISR, const BaseType_t xAdd ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	/*
+	 * [ILG] Place the timer in the slot of the timing wheel for its expiry
+	 * time, relative to xWheelNextTick.  Must be called from a critical section
+	 * if configUSE_TIMER_DIRECT_COMMANDS is set to 1.
+	 */
+	static void prvWheelInsert( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * [ILG] If the wheel holds any timers, set *pxNextEvent to the first tick
+	 * at or after xWheelNextTick at which the wheel has to be processed, either
+	 * because timers expire or because a slot of a higher level has to be
+	 * cascaded to the lower levels, and return pdTRUE.  Only the levels from
+	 * uxFirstLevel up are taken into account.
+	 */
+	static BaseType_t prvWheelGetNextEvent( TimerService_t * const pxService, const UBaseType_t uxFirstLevel, TickType_t * const pxNextEvent ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * [ILG] Move the timers in a slot of a higher level, or in the far list,
+	 * down to the slots their expiry time now falls in.
+	 */
+	static void prvWheelCascade( TimerService_t * const pxService, List_t * const pxSlot ) PRIVILEGED_FUNCTION;
+
+#endif
 
 /*
- * The tick count has overflowed.  Switch the timer lists after ensuring the
- * current timer list does not still reference some timers.
+ * An active timer has reached its expire time.  Reload the timer if it is an
+ * auto reload timer, then call its callback.  [ILG] With configUSE_TIMER_WHEEL
+ * all the timers that expired up to xTimeNow are processed.
  */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+static void prvProcessExpiredTimer( TimerService_t * const pxService, const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_TIMER_WHEEL == 0 )
+
+	/*
+	 * The tick count has overflowed.  Switch the timer lists after ensuring the
+	 * current timer list does not still reference some timers.
+	 */
+	static void prvSwitchTimerLists( TimerService_t * const pxService ) PRIVILEGED_FUNCTION;
+
+#endif
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
  * if a tick count overflow occurred since prvSampleTimeNow() was last called.
  */
-static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
+static TickType_t prvSampleTimeNow( TimerService_t * const pxService, BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
 
 /*
  * If the timer list contains any active timers then return the expire time of
@@ -236,13 +465,26 @@ static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched
  * timer list does not contain any timers then return 0 and set *pxListWasEmpty
  * to pdTRUE.
  */
-static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
+static TickType_t prvGetNextExpireTime( TimerService_t * const pxService, BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
 
 /*
  * If a timer has expired, process it.  Otherwise, block the timer service task
  * until either a timer does expire or a command is received.
  */
-static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
+static void prvProcessTimerOrBlockTask( TimerService_t * const pxService, const TickType_t xNextExpireTime, BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_TIMER_SLACK == 1 )
+
+	/*
+	 * [ILG] The latest time the timer service task can unblock at, if it has to
+	 * process the timers at xNextExpireTime, without calling any callback later
+	 * than the expiry time of its timer plus its slack.  The timers that expire
+	 * up to that time are then processed together.  Must be called from a
+	 * critical section if configUSE_TIMER_DIRECT_COMMANDS is set to 1.
+	 */
+	static TickType_t prvGetWakeTime( TimerService_t * const pxService, const TickType_t xNextExpireTime ) PRIVILEGED_FUNCTION;
+
+#endif
 
 /*
  * Called after a Timer_t structure has been allocated either statically or
@@ -258,6 +500,7 @@ static void prvInitialiseNewTimer(	const char * const pcTimerName,
 
 BaseType_t xTimerCreateTimerTask( void )
 {
+TimerService_t * const pxService = &( xTimerServices[ 0 ] ); // [ILG]
 BaseType_t xReturn = pdFAIL;
 
 	/* This function is called when the scheduler is started if
@@ -266,7 +509,7 @@ BaseType_t xReturn = pdFAIL;
 	been created then the initialisation will already have been performed. */
 	prvCheckForValidListAndQueue();
 
-	if( xTimerQueue != NULL )
+	if( pxService->xTimerQueue != NULL )
 	{
 		#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 		{
@@ -275,15 +518,15 @@ BaseType_t xReturn = pdFAIL;
 			uint32_t ulTimerTaskStackSize;
 
 			vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &ulTimerTaskStackSize );
-			xTimerTaskHandle = xTaskCreateStatic(	prvTimerTask,
+			pxService->xTimerTaskHandle = xTaskCreateStatic(	prvTimerTask,
 													"Tmr Svc",
 													ulTimerTaskStackSize,
-													NULL,
-													( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
+													( void * ) pxService,
+													uxTimerServicePriorities[ 0 ] | portPRIVILEGE_BIT,
 													pxTimerTaskStackBuffer,
 													pxTimerTaskTCBBuffer );
 
-			if( xTimerTaskHandle != NULL )
+			if( pxService->xTimerTaskHandle != NULL )
 			{
 				xReturn = pdPASS;
 			}
@@ -293,9 +536,9 @@ BaseType_t xReturn = pdFAIL;
 			xReturn = xTaskCreate(	prvTimerTask,
 									"Tmr Svc",
 									configTIMER_TASK_STACK_DEPTH,
-									NULL,
-									( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
-									&xTimerTaskHandle );
+									( void * ) pxService,
+									uxTimerServicePriorities[ 0 ] | portPRIVILEGE_BIT,
+									&( pxService->xTimerTaskHandle ) );
 		}
 		#endif /* configSUPPORT_STATIC_ALLOCATION */
 	}
@@ -304,6 +547,53 @@ BaseType_t xReturn = pdFAIL;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
+	// [ILG]
+	#if ( configTIMER_SERVICE_COUNT > 1 )
+	{
+	UBaseType_t uxService;
+
+		/* The other timer service tasks are allocated dynamically if
+		possible, so the application only provides the memory of the first
+		one, as without them. */
+		for( uxService = 1U; ( uxService < ( UBaseType_t ) configTIMER_SERVICE_COUNT ) && ( xReturn != pdFAIL ); uxService++ )
+		{
+			if( xTimerServices[ uxService ].xTimerQueue == NULL )
+			{
+				xReturn = pdFAIL;
+				break;
+			}
+
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				xReturn = xTaskCreate(	prvTimerTask,
+										"Tmr Svc",
+										configTIMER_TASK_STACK_DEPTH,
+										( void * ) &( xTimerServices[ uxService ] ),
+										uxTimerServicePriorities[ uxService ] | portPRIVILEGE_BIT,
+										&( xTimerServices[ uxService ].xTimerTaskHandle ) );
+			}
+			#else
+			{
+				StaticTask_t *pxTimerTaskTCBBuffer = NULL;
+				StackType_t *pxTimerTaskStackBuffer = NULL;
+				uint32_t ulTimerTaskStackSize;
+
+				vApplicationGetTimerServiceTaskMemory( uxService, &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &ulTimerTaskStackSize );
+				xTimerServices[ uxService ].xTimerTaskHandle = xTaskCreateStatic(	prvTimerTask,
+																					"Tmr Svc",
+																					ulTimerTaskStackSize,
+																					( void * ) &( xTimerServices[ uxService ] ),
+																					uxTimerServicePriorities[ uxService ] | portPRIVILEGE_BIT,
+																					pxTimerTaskStackBuffer,
+																					pxTimerTaskTCBBuffer );
+
+				xReturn = ( xTimerServices[ uxService ].xTimerTaskHandle != NULL ) ? pdPASS : pdFAIL;
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+		}
+	}
+	#endif /* configTIMER_SERVICE_COUNT */
+
 	configASSERT( xReturn );
 	return xReturn;
 }
@@ -409,6 +699,26 @@ static void prvInitialiseNewTimer(	const char * const pcTimerName,
 		pxNewTimer->pvTimerID = pvTimerID;
 		pxNewTimer->pxCallbackFunction = pxCallbackFunction;
 		vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
+
+		#if( configUSE_TICK_TIMERS == 1 )
+		{
+			pxNewTimer->ucTickContext = ( uint8_t ) pdFALSE; // [ILG]
+		}
+		#endif
+
+		#if( configTIMER_SERVICE_COUNT > 1 )
+		{
+			pxNewTimer->uxTimerService = ( UBaseType_t ) 0U; // [ILG]
+			pxNewTimer->uxCommandsPending = ( UBaseType_t ) 0U; // [ILG]
+		}
+		#endif
+
+		#if( configUSE_TIMER_SLACK == 1 )
+		{
+			pxNewTimer->xTimerSlack = ( TickType_t ) 0U; // [ILG]
+		}
+		#endif
+
 		traceTIMER_CREATE( pxNewTimer );
 	}
 }
@@ -418,33 +728,72 @@ BaseType_t xTimerGenericCommand( TimerHandle_t xTimer, const BaseType_t xCommand
 {
 BaseType_t xReturn = pdFAIL;
 DaemonTaskMessage_t xMessage;
+TimerService_t *pxService; // [ILG]
 
 	configASSERT( xTimer );
+	pxService = tmrGET_SERVICE( ( Timer_t * ) xTimer ); // [ILG]
+
+	#if ( configUSE_TICK_TIMERS == 1 )
+	{
+		/* [ILG] Timers whose callbacks are called from the tick interrupt
+		are not handled by the timer service task, apart from being
+		deleted. */
+		if( ( ( Timer_t * ) xTimer )->ucTickContext != ( uint8_t ) pdFALSE )
+		{
+			xReturn = prvTickTimerCommand( ( Timer_t * ) xTimer, xCommandID, xOptionalValue );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
 
 	/* Send a message to the timer service task to perform a particular action
 	on a particular timer definition. */
-	if( xTimerQueue != NULL )
+	if( ( pxService->xTimerQueue != NULL ) && ( xReturn == pdFAIL ) ) // [ILG]
 	{
 		/* Send a command to the timer service task to start the xTimer timer. */
 		xMessage.xMessageID = xCommandID;
 		xMessage.u.xTimerParameters.xMessageValue = xOptionalValue;
 		xMessage.u.xTimerParameters.pxTimer = ( Timer_t * ) xTimer;
 
+		#if ( configTIMER_SERVICE_COUNT > 1 )
+		{
+			/* [ILG] Counted before it is sent, as the timer service task can
+			process it before xQueueSendToBack() returns. */
+			prvCountPendingCommand( ( Timer_t * ) xTimer, ( xCommandID >= tmrFIRST_FROM_ISR_COMMAND ) ? pdTRUE : pdFALSE, pdTRUE );
+		}
+		#endif
+
 		if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
 		{
 			if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
 			{
-				xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+				xReturn = xQueueSendToBack( pxService->xTimerQueue, &xMessage, xTicksToWait );
 			}
 			else
 			{
-				xReturn = xQueueSendToBack( xTimerQueue, &xMessage, tmrNO_DELAY );
+				xReturn = xQueueSendToBack( pxService->xTimerQueue, &xMessage, tmrNO_DELAY );
 			}
 		}
 		else
 		{
-			xReturn = xQueueSendToBackFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+			xReturn = xQueueSendToBackFromISR( pxService->xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+		}
+
+		#if ( configTIMER_SERVICE_COUNT > 1 )
+		{
+			if( xReturn == pdFAIL )
+			{
+				prvCountPendingCommand( ( Timer_t * ) xTimer, ( xCommandID >= tmrFIRST_FROM_ISR_COMMAND ) ? pdTRUE : pdFALSE, pdFALSE );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
+		#endif
 
 		traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
 	}
@@ -457,12 +806,250 @@ DaemonTaskMessage_t xMessage;
 }
 /*-----------------------------------------------------------*/
 
+// [ILG]
+#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+
+	BaseType_t xTimerGenericCommandDirect( TimerHandle_t xTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+	const BaseType_t xFromISR = ( xCommandID >= tmrFIRST_FROM_ISR_COMMAND ) ? pdTRUE : pdFALSE;
+	UBaseType_t uxSavedInterruptStatus = 0;
+	TickType_t xTimeNow, xCommandValue;
+	BaseType_t xReturn = pdPASS, xSendCommand = pdFALSE, xHeadChanged = pdFALSE, xResult;
+	TimerService_t *pxService;
+
+		configASSERT( xTimer );
+		pxService = tmrGET_SERVICE( pxTimer );
+		configASSERT( pxService->xTimerQueue );
+
+		if( xFromISR != pdFALSE )
+		{
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			xTimeNow = xTaskGetTickCountFromISR();
+		}
+		else
+		{
+			taskENTER_CRITICAL();
+			xTimeNow = xTaskGetTickCount();
+		}
+
+		/* Should the command have to be sent to the timer service task, the
+		start and reset commands take the time they were issued, and the change
+		period commands the new period. */
+		if( ( xCommandID == tmrCOMMAND_CHANGE_PERIOD ) || ( xCommandID == tmrCOMMAND_CHANGE_PERIOD_FROM_ISR ) )
+		{
+			xCommandValue = xOptionalValue;
+		}
+		else
+		{
+			xCommandValue = xTimeNow;
+		}
+
+		#if ( configUSE_TICK_TIMERS == 1 )
+		if( pxTimer->ucTickContext != ( uint8_t ) pdFALSE )
+		{
+			/* Tick timers are never in the lists of the timer service task,
+			xTimerGenericCommand() updates them in place. */
+			xCommandValue = xOptionalValue;
+			xSendCommand = pdTRUE;
+		}
+		else
+		#endif
+		#if ( configUSE_TIMER_WHEEL == 0 )
+		if( xTimeNow < pxService->xLastTime )
+		{
+			/* The tick count overflowed but the timer service task has not
+			switched the lists yet, so the list a timer starting now would
+			go in is not known.  Leave it to the timer service task. */
+			xSendCommand = pdTRUE;
+		}
+		else
+		#endif
+		if( ( xCommandID != tmrCOMMAND_STOP ) && ( xCommandID != tmrCOMMAND_STOP_FROM_ISR ) &&
+			( pxService->xTimerTaskHandle != NULL ) && ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) )
+		{
+			/* The time the timer service task unblocks cannot be brought
+			forward while the scheduler is suspended, so should the timer
+			expire before any other the task would have to be woken with the
+			command.  That is decided now, before the lists are touched, as
+			sending the command can fail, and a failed command must leave the
+			timer as it was. */
+			xSendCommand = pdTRUE;
+		}
+		else
+		{
+			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+			{
+				prvRemoveTimerFromActiveList( pxTimer );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			switch( xCommandID )
+			{
+				case tmrCOMMAND_CHANGE_PERIOD :
+				case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+					pxTimer->xTimerPeriodInTicks = xOptionalValue;
+					configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+
+					/* As with xTimerChangePeriod(), the timer is then
+					started relative to the current time. */
+					/* Falls through. */
+
+				case tmrCOMMAND_START :
+				case tmrCOMMAND_START_FROM_ISR :
+				case tmrCOMMAND_RESET :
+				case tmrCOMMAND_RESET_FROM_ISR :
+					/* As in prvInsertTimerInActiveList(), which cannot be
+					used from an interrupt.  The period cannot be zero, so
+					the timer can only expire in the future. */
+					listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xTimeNow + pxTimer->xTimerPeriodInTicks );
+					listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+					#if ( configUSE_TIMER_WHEEL == 1 )
+					{
+						if( pxService->uxTimersInWheel == ( UBaseType_t ) 0U )
+						{
+							/* Nothing is waiting to be processed, so the
+							wheel can be moved on to the current time. */
+							pxService->xWheelNextTick = xTimeNow;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						prvWheelInsert( pxTimer );
+
+						/* Does the timer expire before the timer service task
+						next processes the wheel? */
+						if( ( pxService->xWheelNextEventValid == pdFALSE ) ||
+							( ( TickType_t ) ( listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) - pxService->xWheelNextTick ) < ( TickType_t ) ( pxService->xWheelNextEvent - pxService->xWheelNextTick ) ) )
+						{
+							pxService->xWheelNextEvent = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+							pxService->xWheelNextEventValid = pdTRUE;
+							xHeadChanged = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#else
+					{
+						if( listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) <= xTimeNow )
+						{
+							/* The expiry time overflowed. */
+							vListInsert( pxService->pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+						}
+						else
+						{
+							vListInsert( pxService->pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+						}
+
+						if( listGET_OWNER_OF_HEAD_ENTRY( pxService->pxCurrentTimerList ) == pxTimer )
+						{
+							xHeadChanged = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						#if ( configUSE_TIMER_SLACK == 1 )
+						{
+							/* With slack the timer service task may block
+							until after the expiry time at the front of the
+							list. */
+							if( ( listIS_CONTAINED_WITHIN( pxService->pxCurrentTimerList, &( pxTimer->xTimerListItem ) ) != pdFALSE ) &&
+								( listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) < pxService->xWakeTime ) )
+							{
+								xHeadChanged = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif
+					}
+					#endif
+
+					if( xHeadChanged != pdFALSE )
+					{
+						/* The timer expires before any other, which the
+						timer service task may already be waiting for.
+						Bring the time it unblocks forward. */
+						pxService->xActiveListHeadChanged = pdTRUE;
+
+						if( pxService->xTimerTaskHandle != NULL )
+						{
+							/* This only fails with the scheduler
+							suspended, which was ruled out above. */
+							xResult = xTaskAdvanceTimeout( pxService->xTimerTaskHandle, pxTimer->xTimerPeriodInTicks );
+							configASSERT( xResult != pdFAIL );
+							( void ) xResult;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+					break;
+
+				case tmrCOMMAND_STOP :
+				case tmrCOMMAND_STOP_FROM_ISR :
+					/* The timer has already been removed from the active
+					list.  If it was at the front of the list the timer
+					service task wakes up early, and finds nothing to do. */
+					break;
+
+				default :
+					/* Deleting a timer is left to the timer service
+					task. */
+					configASSERT( pdFALSE );
+					break;
+			}
+		}
+
+		if( xFromISR != pdFALSE )
+		{
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			taskEXIT_CRITICAL();
+		}
+
+		if( xSendCommand != pdFALSE )
+		{
+			xReturn = xTimerGenericCommand( xTimer, xCommandID, xCommandValue, pxHigherPriorityTaskWoken, tmrNO_DELAY );
+		}
+		else
+		{
+			traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TIMER_DIRECT_COMMANDS */
+/*-----------------------------------------------------------*/
+
 TaskHandle_t xTimerGetTimerDaemonTaskHandle( void )
 {
+TimerService_t * const pxService = &( xTimerServices[ 0 ] ); // [ILG]
+
 	/* If xTimerGetTimerDaemonTaskHandle() is called before the scheduler has been
 	started, then xTimerTaskHandle will be NULL. */
-	configASSERT( ( xTimerTaskHandle != NULL ) );
-	return xTimerTaskHandle;
+	configASSERT( ( pxService->xTimerTaskHandle != NULL ) );
+	return pxService->xTimerTaskHandle;
 }
 /*-----------------------------------------------------------*/
 
@@ -495,58 +1082,199 @@ Timer_t *pxTimer = ( Timer_t * ) xTimer;
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
-{
-BaseType_t xResult;
-Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
-
-	/* Remove the timer from the list of active timers.  A check has already
-	been performed to ensure the list is not empty. */
-	( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-	traceTIMER_EXPIRED( pxTimer );
+#if ( configUSE_TIMER_WHEEL == 1 )
 
-	/* If the timer is an auto reload timer then calculate the next
-	expiry time and re-insert the timer in the list of active timers. */
-	if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+	static void prvProcessExpiredTimer( TimerService_t * const pxService, const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 	{
-		/* The timer is inserted into a list using a time relative to anything
-		other than the current time.  It will therefore be inserted into the
-		correct list relative to the time this task thinks it is now. */
-		if( prvInsertTimerInActiveList( pxTimer, ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xNextExpireTime ) != pdFALSE )
-		{
-			/* The timer expired before it was added to the active timer
-			list.  Reload it now.  */
-			xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
-			configASSERT( xResult );
-			( void ) xResult;
-		}
-		else
+	Timer_t *pxTimer;
+	TickType_t xTick, xNextEvent;
+	UBaseType_t uxLevel;
+	BaseType_t xMoreTicks = pdTRUE, xCascade;
+
+		/* The next event time only tells the timer service task the wheel
+		needs processing.  Every tick from xWheelNextTick up to xTimeNow is
+		processed, skipping the ticks at which nothing happens. */
+		( void ) xNextExpireTime;
+
+		while( xMoreTicks != pdFALSE )
 		{
-			mtCOVERAGE_TEST_MARKER();
-		}
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
+			pxTimer = NULL;
+			xCascade = pdFALSE;
+
+			tmrENTER_LIST_CRITICAL();
+			{
+				xTick = pxService->xWheelNextTick;
+
+				/* All the timers in the level 0 slot of the tick expire at that
+				tick.  They are processed one at a time, so the callbacks are
+				not called from a critical section. */
+				if( tmrTIME_REACHED( xTick, xTimeNow ) == pdFALSE )
+				{
+					xMoreTicks = pdFALSE;
+				}
+				else if( listLIST_IS_EMPTY( &( pxService->xTimerWheel[ 0 ][ tmrWHEEL_SLOT( xTick, 0U ) ] ) ) == pdFALSE )
+				{
+					pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( pxService->xTimerWheel[ 0 ][ tmrWHEEL_SLOT( xTick, 0U ) ] ) );
+					prvRemoveTimerFromActiveList( pxTimer );
+					traceTIMER_EXPIRED( pxTimer );
+
+					if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+					{
+						/* The reload time is after xTick, so it does not go in
+						the slot being processed.  If the timer service task
+						is behind it is processed again within this loop. */
+						listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xTick + pxTimer->xTimerPeriodInTicks );
+						prvWheelInsert( pxTimer );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* The tick has been processed.  Move on to the next tick at
+					which there is something to do, or past xTimeNow. */
+					pxService->xWheelNextTick = xTick + ( TickType_t ) 1U;
+
+					if( ( prvWheelGetNextEvent( pxService, 0U, &xNextEvent ) != pdFALSE ) && ( tmrTIME_REACHED( xNextEvent, xTimeNow ) != pdFALSE ) )
+					{
+						pxService->xWheelNextTick = xNextEvent;
+					}
+					else
+					{
+						pxService->xWheelNextTick = xTimeNow + ( TickType_t ) 1U;
+					}
+
+					/* Any slots of the higher levels that start at the new tick
+					have to be cascaded before its level 0 slot is processed. */
+					xCascade = pdTRUE;
+					xTick = pxService->xWheelNextTick;
+				}
+			}
+			tmrEXIT_LIST_CRITICAL();
+
+			if( pxTimer != NULL )
+			{
+				/* Call the timer callback. */
+	#if defined(configUSE_CMSIS_PLUS)
+				// [ILG] use ID to store CMSIS args
+				pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer->pvTimerID );
+	#else
+				pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+	#endif
+			}
+			else if( xCascade != pdFALSE )
+			{
+				/* A slot of level n starts when the low n * tmrWHEEL_SLOT_BITS
+				bits of the tick are zero. */
+				for( uxLevel = 1U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+				{
+					if( ( xTick & ( tmrWHEEL_LEVEL_TICKS( uxLevel ) - ( TickType_t ) 1U ) ) != ( TickType_t ) 0U )
+					{
+						break;
+					}
+
+					prvWheelCascade( pxService, &( pxService->xTimerWheel[ uxLevel ][ tmrWHEEL_SLOT( xTick, uxLevel ) ] ) );
+				}
+
+				if( ( uxLevel == ( UBaseType_t ) configTIMER_WHEEL_LEVELS ) &&
+					( ( xTick & ( tmrWHEEL_LEVEL_TICKS( configTIMER_WHEEL_LEVELS ) - ( TickType_t ) 1U ) ) == ( TickType_t ) 0U ) )
+				{
+					prvWheelCascade( pxService, &pxService->xTimerWheelFarList );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
 	}
 
-	/* Call the timer callback. */
+#else /* configUSE_TIMER_WHEEL */
+
+static void prvProcessExpiredTimer( TimerService_t * const pxService, const TickType_t xNextExpireTime, const TickType_t xTimeNow )
+{
+BaseType_t xResult, xReloadNow = pdFALSE;
+Timer_t *pxTimer = NULL;
+
+	tmrENTER_LIST_CRITICAL(); // [ILG]
+	{
+		/* [ILG] A check has already been performed to ensure the list is not
+		empty, but with configUSE_TIMER_DIRECT_COMMANDS the timer at its front
+		may have been stopped, or an earlier one started, since.  The timer
+		service task then checks the list again. */
+		if( ( listLIST_IS_EMPTY( pxService->pxCurrentTimerList ) == pdFALSE ) && ( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxService->pxCurrentTimerList ) == xNextExpireTime ) )
+		{
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxService->pxCurrentTimerList );
+
+			/* Remove the timer from the list of active timers. */
+			prvRemoveTimerFromActiveList( pxTimer );
+			traceTIMER_EXPIRED( pxTimer );
+
+			/* If the timer is an auto reload timer then calculate the next
+			expiry time and re-insert the timer in the list of active timers. */
+			if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+			{
+				/* The timer is inserted into a list using a time relative to
+				anything other than the current time.  It will therefore be
+				inserted into the correct list relative to the time this task
+				thinks it is now. */
+				xReloadNow = prvInsertTimerInActiveList( pxTimer, ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xNextExpireTime );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	tmrEXIT_LIST_CRITICAL(); // [ILG]
+
+	if( pxTimer != NULL )
+	{
+		if( xReloadNow != pdFALSE )
+		{
+			/* The timer expired before it was added to the active timer
+			list.  Reload it now.  */
+			xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
+			configASSERT( xResult );
+			( void ) xResult;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Call the timer callback. */
 #if defined(configUSE_CMSIS_PLUS)
-  // [ILG] use ID to store CMSIS args
-  pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer->pvTimerID );
+		// [ILG] use ID to store CMSIS args
+		pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer->pvTimerID );
 #else
-	pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+		pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 #endif
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvTimerTask( void *pvParameters )
 {
 TickType_t xNextExpireTime;
 BaseType_t xListWasEmpty;
-
-	/* Just to avoid compiler warnings. */
-	( void ) pvParameters;
+TimerService_t * const pxService = ( TimerService_t * ) pvParameters; // [ILG]
 
 	#if( configUSE_DAEMON_TASK_STARTUP_HOOK == 1 )
 	{
@@ -555,8 +1283,16 @@ BaseType_t xListWasEmpty;
 		/* Allow the application writer to execute some code in the context of
 		this task at the point the task starts executing.  This is useful if the
 		application includes initialisation code that would benefit from
-		executing after the scheduler has been started. */
-		vApplicationDaemonTaskStartupHook();
+		executing after the scheduler has been started.  [ILG] Only the first
+		timer service task calls it. */
+		if( pxService == &( xTimerServices[ 0 ] ) )
+		{
+			vApplicationDaemonTaskStartupHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 	}
 	#endif /* configUSE_DAEMON_TASK_STARTUP_HOOK */
 
@@ -564,21 +1300,22 @@ BaseType_t xListWasEmpty;
 	{
 		/* Query the timers list to see if it contains any timers, and if so,
 		obtain the time at which the next timer will expire. */
-		xNextExpireTime = prvGetNextExpireTime( &xListWasEmpty );
+		xNextExpireTime = prvGetNextExpireTime( pxService, &xListWasEmpty );
 
 		/* If a timer has expired, process it.  Otherwise, block this task
 		until either a timer does expire, or a command is received. */
-		prvProcessTimerOrBlockTask( xNextExpireTime, xListWasEmpty );
+		prvProcessTimerOrBlockTask( pxService, xNextExpireTime, xListWasEmpty );
 
 		/* Empty the command queue. */
-		prvProcessReceivedCommands();
+		prvProcessReceivedCommands( pxService );
 	}
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
+static void prvProcessTimerOrBlockTask( TimerService_t * const pxService, const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
 {
 TickType_t xTimeNow;
+TickType_t xWakeTime; // [ILG]
 BaseType_t xTimerListsWereSwitched;
 
 	vTaskSuspendAll();
@@ -588,14 +1325,20 @@ BaseType_t xTimerListsWereSwitched;
 		then don't process this timer as any timers that remained in the list
 		when the lists were switched will have been processed within the
 		prvSampleTimeNow() function. */
-		xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+		xTimeNow = prvSampleTimeNow( pxService, &xTimerListsWereSwitched );
 		if( xTimerListsWereSwitched == pdFALSE )
 		{
 			/* The tick count has not overflowed, has the timer expired? */
+			#if ( configUSE_TIMER_WHEEL == 1 )
+			/* [ILG] Times in the wheel are relative to xWheelNextTick, and
+			are not kept in lists that switch on an overflow. */
+			if( ( xListWasEmpty == pdFALSE ) && ( tmrTIME_REACHED( xNextExpireTime, xTimeNow ) != pdFALSE ) )
+			#else
 			if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
+			#endif
 			{
 				( void ) xTaskResumeAll();
-				prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
+				prvProcessExpiredTimer( pxService, xNextExpireTime, xTimeNow );
 			}
 			else
 			{
@@ -605,14 +1348,62 @@ BaseType_t xTimerListsWereSwitched;
 				received - whichever comes first.  The following line cannot
 				be reached unless xNextExpireTime > xTimeNow, except in the
 				case when the current timer list is empty. */
-				if( xListWasEmpty != pdFALSE )
+				#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+				{
+					/* [ILG] Never block indefinitely, so a timer started
+					directly can bring the time this task unblocks forward with
+					xTaskAdvanceTimeout().  With both lists empty the task
+					unblocks when the tick count overflows. */
+					xListWasEmpty = pdFALSE;
+				}
+				#else
 				{
-					/* The current timer list is empty - is the overflow list
-					also empty? */
-					xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+					if( xListWasEmpty != pdFALSE )
+					{
+						/* The current timer list is empty - is the overflow list
+						also empty? */
+						xListWasEmpty = listLIST_IS_EMPTY( pxService->pxOverflowTimerList );
+					}
 				}
+				#endif
+
+				tmrENTER_LIST_CRITICAL(); // [ILG]
+				{
+					#if ( configUSE_TIMER_SLACK == 1 )
+					{
+						/* [ILG] Block for as long as the slack of the timers
+						allows, so the timers that expire close to each other
+						are processed after a single wake up. */
+						xWakeTime = prvGetWakeTime( pxService, xNextExpireTime );
+
+						#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+						{
+							/* Timers started directly compare their expiry
+							time with it. */
+							#if ( configUSE_TIMER_WHEEL == 1 )
+								pxService->xWheelNextEvent = xWakeTime;
+							#else
+								pxService->xWakeTime = xWakeTime;
+							#endif
+						}
+						#endif
+					}
+					#else
+					{
+						xWakeTime = xNextExpireTime;
+					}
+					#endif
 
-				vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+					#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+					/* [ILG] Don't block if a timer that expires before
+					xNextExpireTime was started directly since it was read. */
+					if( pxService->xActiveListHeadChanged == pdFALSE )
+					#endif
+					{
+						vQueueWaitForMessageRestricted( pxService->xTimerQueue, ( xWakeTime - xTimeNow ), xListWasEmpty );
+					}
+				}
+				tmrEXIT_LIST_CRITICAL(); // [ILG]
 
 				if( xTaskResumeAll() == pdFALSE )
 				{
@@ -636,7 +1427,7 @@ BaseType_t xTimerListsWereSwitched;
 }
 /*-----------------------------------------------------------*/
 
-static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+static TickType_t prvGetNextExpireTime( TimerService_t * const pxService, BaseType_t * const pxListWasEmpty )
 {
 TickType_t xNextExpireTime;
 
@@ -647,93 +1438,474 @@ TickType_t xNextExpireTime;
 	this task to unblock when the tick count overflows, at which point the
 	timer lists will be switched and the next expiry time can be
 	re-assessed.  */
-	*pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
-	if( *pxListWasEmpty == pdFALSE )
+	tmrENTER_LIST_CRITICAL(); // [ILG]
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
-	}
-	else
-	{
-		/* Ensure the task unblocks when the tick count rolls over. */
-		xNextExpireTime = ( TickType_t ) 0U;
+		#if ( configUSE_TIMER_WHEEL == 1 )
+		{
+			/* [ILG] The time of the next tick at which the wheel has to be
+			processed. */
+			if( prvWheelGetNextEvent( pxService, 0U, &xNextExpireTime ) != pdFALSE )
+			{
+				*pxListWasEmpty = pdFALSE;
+			}
+			else
+			{
+				*pxListWasEmpty = pdTRUE;
+				xNextExpireTime = ( TickType_t ) 0U;
+			}
+
+			#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+			{
+				pxService->xWheelNextEvent = xNextExpireTime;
+				pxService->xWheelNextEventValid = ( *pxListWasEmpty == pdFALSE ) ? pdTRUE : pdFALSE;
+			}
+			#endif
+		}
+		#else
+		{
+			*pxListWasEmpty = listLIST_IS_EMPTY( pxService->pxCurrentTimerList );
+			if( *pxListWasEmpty == pdFALSE )
+			{
+				xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxService->pxCurrentTimerList );
+			}
+			else
+			{
+				/* Ensure the task unblocks when the tick count rolls over. */
+				xNextExpireTime = ( TickType_t ) 0U;
+			}
+		}
+		#endif
+
+		#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+		{
+			pxService->xActiveListHeadChanged = pdFALSE;
+		}
+		#endif
 	}
+	tmrEXIT_LIST_CRITICAL(); // [ILG]
 
 	return xNextExpireTime;
 }
 /*-----------------------------------------------------------*/
 
-static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+// [ILG]
+#if ( configUSE_TIMER_SLACK == 1 )
+
+	#if ( configUSE_TIMER_WHEEL == 1 )
+
+	static TickType_t prvGetWakeTime( TimerService_t * const pxService, const TickType_t xNextExpireTime )
+	{
+	const ListItem_t *pxItem;
+	const ListItem_t *pxListEnd;
+	TickType_t xCascadeTime, xTicks, xLatestTicks, xTicksToWake;
+	UBaseType_t uxSlot;
+
+		/* Times are counted from xWheelNextTick.  The timers in the higher
+		levels are only known to expire after their slot is cascaded, so the
+		wheel has to be processed at the next cascade at the latest. */
+		if( prvWheelGetNextEvent( pxService, 1U, &xCascadeTime ) != pdFALSE )
+		{
+			xTicksToWake = ( TickType_t ) ( xCascadeTime - pxService->xWheelNextTick );
+		}
+		else
+		{
+			xTicksToWake = portMAX_DELAY;
+		}
+
+		/* The timers in a slot of the lowest level all expire at the tick of
+		the slot.  Go through the slots from xNextExpireTime up to the earliest
+		expiry time plus slack found so far. */
+		for( xTicks = ( TickType_t ) ( xNextExpireTime - pxService->xWheelNextTick ); ( xTicks < ( TickType_t ) tmrWHEEL_SLOTS ) && ( xTicks < xTicksToWake ); xTicks++ )
+		{
+			uxSlot = tmrWHEEL_SLOT( pxService->xWheelNextTick + xTicks, 0U );
+
+			if( ( pxService->ulWheelSlotsInUse[ 0 ] & ( ( uint32_t ) 1U << uxSlot ) ) != ( uint32_t ) 0U )
+			{
+				pxListEnd = listGET_END_MARKER( &( pxService->xTimerWheel[ 0 ][ uxSlot ] ) );
+
+				for( pxItem = listGET_HEAD_ENTRY( &( pxService->xTimerWheel[ 0 ][ uxSlot ] ) ); pxItem != pxListEnd; pxItem = listGET_NEXT( pxItem ) )
+				{
+					xLatestTicks = xTicks + ( ( Timer_t * ) listGET_LIST_ITEM_OWNER( pxItem ) )->xTimerSlack;
+
+					if( xLatestTicks < xTicksToWake )
+					{
+						xTicksToWake = xLatestTicks;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( xTicksToWake == portMAX_DELAY )
+		{
+			/* The wheel is empty. */
+			return xNextExpireTime;
+		}
+		else
+		{
+			return ( TickType_t ) ( pxService->xWheelNextTick + xTicksToWake );
+		}
+	}
+
+	#else /* configUSE_TIMER_WHEEL */
+
+	static TickType_t prvGetWakeTime( TimerService_t * const pxService, const TickType_t xNextExpireTime )
+	{
+	const ListItem_t *pxItem;
+	const ListItem_t * const pxListEnd = listGET_END_MARKER( pxService->pxCurrentTimerList );
+	TickType_t xExpiryTime, xLatestTime, xWakeTime;
+
+		if( listLIST_IS_EMPTY( pxService->pxCurrentTimerList ) != pdFALSE )
+		{
+			/* Unblock when the tick count overflows. */
+			xWakeTime = xNextExpireTime;
+		}
+		else
+		{
+			/* The timers are in expiry time order, so only the ones that
+			expire before the earliest expiry time plus slack found so far
+			have to be looked at. */
+			xWakeTime = portMAX_DELAY;
+
+			for( pxItem = listGET_HEAD_ENTRY( pxService->pxCurrentTimerList ); ( pxItem != pxListEnd ) && ( listGET_LIST_ITEM_VALUE( pxItem ) < xWakeTime ); pxItem = listGET_NEXT( pxItem ) )
+			{
+				xExpiryTime = listGET_LIST_ITEM_VALUE( pxItem );
+				xLatestTime = xExpiryTime + ( ( Timer_t * ) listGET_LIST_ITEM_OWNER( pxItem ) )->xTimerSlack;
+
+				if( xLatestTime < xExpiryTime )
+				{
+					/* The slack goes past the tick count overflowing, when
+					the lists are switched and the timers processed anyway. */
+					xLatestTime = portMAX_DELAY;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xLatestTime < xWakeTime )
+				{
+					xWakeTime = xLatestTime;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+
+		return xWakeTime;
+	}
+
+	#endif /* configUSE_TIMER_WHEEL */
+
+#endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
+static TickType_t prvSampleTimeNow( TimerService_t * const pxService, BaseType_t * const pxTimerListsWereSwitched )
 {
 TickType_t xTimeNow;
-PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Variable is only accessible to one task. */
 
 	xTimeNow = xTaskGetTickCount();
 
-	if( xTimeNow < xLastTime )
+	#if ( configUSE_TIMER_WHEEL == 1 )
 	{
-		prvSwitchTimerLists();
-		*pxTimerListsWereSwitched = pdTRUE;
+		/* [ILG] The wheel does not depend on the tick count not overflowing. */
+		*pxTimerListsWereSwitched = pdFALSE;
 	}
-	else
+	#else
 	{
-		*pxTimerListsWereSwitched = pdFALSE;
+		if( xTimeNow < pxService->xLastTime )
+		{
+			prvSwitchTimerLists( pxService );
+			*pxTimerListsWereSwitched = pdTRUE;
+		}
+		else
+		{
+			*pxTimerListsWereSwitched = pdFALSE;
+		}
 	}
+	#endif
 
-	xLastTime = xTimeNow;
+	pxService->xLastTime = xTimeNow;
 
 	return xTimeNow;
 }
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
-{
-BaseType_t xProcessTimerNow = pdFALSE;
+static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
+{
+BaseType_t xProcessTimerNow = pdFALSE;
+TimerService_t * const pxService = tmrGET_SERVICE( pxTimer ); // [ILG]
+
+	tmrENTER_LIST_CRITICAL(); // [ILG]
+
+	#if ( configUSE_TIMER_DIRECT_COMMANDS == 1 )
+	{
+		/* [ILG] The timer may have been started directly since the command
+		that is being processed removed it from the active lists. */
+		if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+		{
+			prvRemoveTimerFromActiveList( pxTimer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
+	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+	#if ( configUSE_TIMER_WHEEL == 1 )
+	{
+		/* [ILG] Has the expiry time elapsed between the command being issued
+		and the command being processed?  Measured from the time the command
+		was issued, so the tick count overflowing does not matter. */
+		if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= ( ( TickType_t ) ( xNextExpiryTime - xCommandTime ) ) )
+		{
+			xProcessTimerNow = pdTRUE;
+		}
+		else
+		{
+			if( pxService->uxTimersInWheel == ( UBaseType_t ) 0U )
+			{
+				/* Nothing is waiting to be processed, so the wheel can be
+				moved on to the current time. */
+				pxService->xWheelNextTick = xTimeNow;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			prvWheelInsert( pxTimer );
+		}
+	}
+	#else
+	if( xNextExpiryTime <= xTimeNow )
+	{
+		/* Has the expiry time elapsed between the command to start/reset a
+		timer was issued, and the time the command was processed? */
+		if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		{
+			/* The time between a command being issued and the command being
+			processed actually exceeds the timers period.  */
+			xProcessTimerNow = pdTRUE;
+		}
+		else
+		{
+			vListInsert( pxService->pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+		}
+	}
+	else
+	{
+		if( ( xTimeNow < xCommandTime ) && ( xNextExpiryTime >= xCommandTime ) )
+		{
+			/* If, since the command was issued, the tick count has overflowed
+			but the expiry time has not, then the timer must have already passed
+			its expiry time and should be processed immediately. */
+			xProcessTimerNow = pdTRUE;
+		}
+		else
+		{
+			vListInsert( pxService->pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+		}
+	}
+	#endif /* configUSE_TIMER_WHEEL */
+
+	tmrEXIT_LIST_CRITICAL(); // [ILG]
+
+	return xProcessTimerNow;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveTimerFromActiveList( Timer_t * const pxTimer )
+{
+	#if ( configUSE_TIMER_WHEEL == 1 )
+	{
+	TimerService_t * const pxService = tmrGET_SERVICE( pxTimer );
+	List_t * const pxSlot = ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) );
+	UBaseType_t uxIndex;
+
+		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+		pxService->uxTimersInWheel--;
+
+		if( ( pxSlot != &pxService->xTimerWheelFarList ) && ( listLIST_IS_EMPTY( pxSlot ) != pdFALSE ) )
+		{
+			/* The slot is now empty.  Its position in the wheel gives the bit
+			to clear. */
+			uxIndex = ( UBaseType_t ) ( pxSlot - &( pxService->xTimerWheel[ 0 ][ 0 ] ) );
+			pxService->ulWheelSlotsInUse[ uxIndex >> tmrWHEEL_SLOT_BITS ] &= ~( ( uint32_t ) 1U << ( uxIndex & tmrWHEEL_SLOT_MASK ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	static void prvWheelInsert( Timer_t * const pxTimer )
+	{
+	TimerService_t * const pxService = tmrGET_SERVICE( pxTimer );
+	const TickType_t xExpiryTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+
+	/* The callers never insert a timer that expires before xWheelNextTick, so
+	this is the full time to expiry, even if it is more than half the tick
+	count range. */
+	const TickType_t xTicksToExpiry = ( TickType_t ) ( xExpiryTime - pxService->xWheelNextTick );
+	UBaseType_t uxLevel, uxSlot;
+
+		listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+		pxService->uxTimersInWheel++;
+
+		/* Find the lowest level that reaches the expiry time.  Timers go at
+		the end of their slot, no sorting is needed. */
+		for( uxLevel = 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+		{
+			if( xTicksToExpiry < tmrWHEEL_LEVEL_TICKS( uxLevel + 1U ) )
+			{
+				uxSlot = tmrWHEEL_SLOT( xExpiryTime, uxLevel );
+				vListInsertEnd( &( pxService->xTimerWheel[ uxLevel ][ uxSlot ] ), &( pxTimer->xTimerListItem ) );
+				pxService->ulWheelSlotsInUse[ uxLevel ] |= ( ( uint32_t ) 1U << uxSlot );
+				return;
+			}
+		}
+
+		vListInsertEnd( &pxService->xTimerWheelFarList, &( pxTimer->xTimerListItem ) );
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvWheelGetNextEvent( TimerService_t * const pxService, const UBaseType_t uxFirstLevel, TickType_t * const pxNextEvent )
+	{
+	TickType_t xStart, xEvent, xTicksToEvent = portMAX_DELAY;
+	UBaseType_t uxLevel, uxSlot, uxOffset;
+	uint32_t ulSlots;
+	BaseType_t xReturn = pdFALSE;
+
+		for( uxLevel = uxFirstLevel; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+		{
+			ulSlots = pxService->ulWheelSlotsInUse[ uxLevel ];
+
+			if( ulSlots != ( uint32_t ) 0U )
+			{
+				/* The first slot of the level that starts at or after the next
+				tick to process, then the first slot in use from there on. */
+				xStart = pxService->xWheelNextTick + ( ( ( TickType_t ) 0U - pxService->xWheelNextTick ) & ( tmrWHEEL_LEVEL_TICKS( uxLevel ) - ( TickType_t ) 1U ) );
+				uxSlot = tmrWHEEL_SLOT( xStart, uxLevel );
+
+				/* Stops at the latest after a full turn, as a slot is in use. */
+				uxOffset = 0U;
+				while( ( ulSlots & ( ( uint32_t ) 1U << ( ( uxSlot + uxOffset ) & tmrWHEEL_SLOT_MASK ) ) ) == ( uint32_t ) 0U )
+				{
+					uxOffset++;
+				}
 
-	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
-	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+				xEvent = xStart + ( ( TickType_t ) uxOffset << ( uxLevel * tmrWHEEL_SLOT_BITS ) );
 
-	if( xNextExpiryTime <= xTimeNow )
-	{
-		/* Has the expiry time elapsed between the command to start/reset a
-		timer was issued, and the time the command was processed? */
-		if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				if( ( xReturn == pdFALSE ) || ( ( TickType_t ) ( xEvent - pxService->xWheelNextTick ) < xTicksToEvent ) )
+				{
+					xTicksToEvent = ( TickType_t ) ( xEvent - pxService->xWheelNextTick );
+					*pxNextEvent = xEvent;
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( listLIST_IS_EMPTY( &pxService->xTimerWheelFarList ) == pdFALSE )
 		{
-			/* The time between a command being issued and the command being
-			processed actually exceeds the timers period.  */
-			xProcessTimerNow = pdTRUE;
+			/* The far list is cascaded when the last level wraps. */
+			xEvent = pxService->xWheelNextTick + ( ( ( TickType_t ) 0U - pxService->xWheelNextTick ) & ( tmrWHEEL_LEVEL_TICKS( configTIMER_WHEEL_LEVELS ) - ( TickType_t ) 1U ) );
+
+			if( ( xReturn == pdFALSE ) || ( ( TickType_t ) ( xEvent - pxService->xWheelNextTick ) < xTicksToEvent ) )
+			{
+				*pxNextEvent = xEvent;
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 		else
 		{
-			vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			mtCOVERAGE_TEST_MARKER();
 		}
+
+		return xReturn;
 	}
-	else
+	/*-----------------------------------------------------------*/
+
+	static void prvWheelCascade( TimerService_t * const pxService, List_t * const pxSlot )
 	{
-		if( ( xTimeNow < xCommandTime ) && ( xNextExpiryTime >= xCommandTime ) )
+	Timer_t *pxTimer;
+	UBaseType_t uxTimersToMove;
+
+		/* Only the timers in the slot now are moved, one at a time to keep
+		the critical sections short. */
+		tmrENTER_LIST_CRITICAL();
 		{
-			/* If, since the command was issued, the tick count has overflowed
-			but the expiry time has not, then the timer must have already passed
-			its expiry time and should be processed immediately. */
-			xProcessTimerNow = pdTRUE;
+			uxTimersToMove = listCURRENT_LIST_LENGTH( pxSlot );
 		}
-		else
+		tmrEXIT_LIST_CRITICAL();
+
+		while( uxTimersToMove > ( UBaseType_t ) 0U )
 		{
-			vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+			tmrENTER_LIST_CRITICAL();
+			{
+				if( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+				{
+					pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+					prvRemoveTimerFromActiveList( pxTimer );
+					prvWheelInsert( pxTimer );
+				}
+				else
+				{
+					/* Timers were stopped directly meanwhile. */
+					uxTimersToMove = ( UBaseType_t ) 1U;
+				}
+			}
+			tmrEXIT_LIST_CRITICAL();
+
+			uxTimersToMove--;
 		}
 	}
 
-	return xProcessTimerNow;
-}
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
-static void	prvProcessReceivedCommands( void )
+static void	prvProcessReceivedCommands( TimerService_t * const pxService )
 {
 DaemonTaskMessage_t xMessage;
 Timer_t *pxTimer;
 BaseType_t xTimerListsWereSwitched, xResult;
 TickType_t xTimeNow;
 
-	while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
+	while( xQueueReceive( pxService->xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
 	{
 		#if ( INCLUDE_xTimerPendFunctionCall == 1 )
 		{
@@ -765,15 +1937,19 @@ TickType_t xTimeNow;
 			software timer. */
 			pxTimer = xMessage.u.xTimerParameters.pxTimer;
 
-			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
-			{
-				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-			}
-			else
+			tmrENTER_LIST_CRITICAL(); // [ILG]
 			{
-				mtCOVERAGE_TEST_MARKER();
+				if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+				{
+					/* The timer is in a list, remove it. */
+					prvRemoveTimerFromActiveList( pxTimer );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
+			tmrEXIT_LIST_CRITICAL(); // [ILG]
 
 			traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
 
@@ -783,7 +1959,7 @@ TickType_t xTimeNow;
 			possibility of a higher priority task adding a message to the message
 			queue with a time that is ahead of the timer daemon task (because it
 			pre-empted the timer daemon task after the xTimeNow value was set). */
-			xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+			xTimeNow = prvSampleTimeNow( pxService, &xTimerListsWereSwitched );
 
 			switch( xMessage.xMessageID )
 			{
@@ -868,12 +2044,29 @@ TickType_t xTimeNow;
 					/* Don't expect to get here. */
 					break;
 			}
+
+			#if ( configTIMER_SERVICE_COUNT > 1 )
+			{
+				/* [ILG] The command is only complete now that the timer is in
+				the lists it will stay in.  A deleted timer no longer exists. */
+				if( xMessage.xMessageID != tmrCOMMAND_DELETE )
+				{
+					prvCountPendingCommand( pxTimer, pdFALSE, pdFALSE );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
 		}
 	}
 }
 /*-----------------------------------------------------------*/
 
-static void prvSwitchTimerLists( void )
+#if ( configUSE_TIMER_WHEEL == 0 )
+
+static void prvSwitchTimerLists( TimerService_t * const pxService )
 {
 TickType_t xNextExpireTime, xReloadTime;
 List_t *pxTemp;
@@ -884,40 +2077,68 @@ BaseType_t xResult;
 	If there are any timers still referenced from the current timer list
 	then they must have expired and should be processed before the lists
 	are switched. */
-	while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+	while( listLIST_IS_EMPTY( pxService->pxCurrentTimerList ) == pdFALSE )
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+		pxTimer = NULL;
 
-		/* Remove the timer from the list. */
-		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
-		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-		traceTIMER_EXPIRED( pxTimer );
+		tmrENTER_LIST_CRITICAL(); // [ILG]
+		{
+			/* [ILG] With configUSE_TIMER_DIRECT_COMMANDS the timer may have
+			been stopped since the list was checked.  Timers are not started
+			directly until the lists have been switched, see
+			xTimerGenericCommandDirect(). */
+			if( listLIST_IS_EMPTY( pxService->pxCurrentTimerList ) == pdFALSE )
+			{
+				xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxService->pxCurrentTimerList );
 
-		/* Execute its callback, then send a command to restart the timer if
-		it is an auto-reload timer.  It cannot be restarted here as the lists
-		have not yet been switched. */
-		pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+				/* Remove the timer from the list. */
+				pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxService->pxCurrentTimerList );
+				prvRemoveTimerFromActiveList( pxTimer );
+				traceTIMER_EXPIRED( pxTimer );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		tmrEXIT_LIST_CRITICAL(); // [ILG]
 
-		if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+		if( pxTimer != NULL )
 		{
-			/* Calculate the reload value, and if the reload value results in
-			the timer going into the same timer list then it has already expired
-			and the timer should be re-inserted into the current list so it is
-			processed again within this loop.  Otherwise a command should be sent
-			to restart the timer to ensure it is only inserted into a list after
-			the lists have been swapped. */
-			xReloadTime = ( xNextExpireTime + pxTimer->xTimerPeriodInTicks );
-			if( xReloadTime > xNextExpireTime )
+			/* Execute its callback, then send a command to restart the timer if
+			it is an auto-reload timer.  It cannot be restarted here as the lists
+			have not yet been switched. */
+			pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+
+			if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
 			{
-				listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
-				listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
-				vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+				/* Calculate the reload value, and if the reload value results in
+				the timer going into the same timer list then it has already expired
+				and the timer should be re-inserted into the current list so it is
+				processed again within this loop.  Otherwise a command should be sent
+				to restart the timer to ensure it is only inserted into a list after
+				the lists have been swapped. */
+				xReloadTime = ( xNextExpireTime + pxTimer->xTimerPeriodInTicks );
+				if( xReloadTime > xNextExpireTime )
+				{
+					tmrENTER_LIST_CRITICAL(); // [ILG]
+					{
+						listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
+						listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+						vListInsert( pxService->pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+					}
+					tmrEXIT_LIST_CRITICAL(); // [ILG]
+				}
+				else
+				{
+					xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
+					configASSERT( xResult );
+					( void ) xResult;
+				}
 			}
 			else
 			{
-				xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
-				configASSERT( xResult );
-				( void ) xResult;
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
 		else
@@ -926,61 +2147,370 @@ BaseType_t xResult;
 		}
 	}
 
-	pxTemp = pxCurrentTimerList;
-	pxCurrentTimerList = pxOverflowTimerList;
-	pxOverflowTimerList = pxTemp;
+	tmrENTER_LIST_CRITICAL(); // [ILG]
+	{
+		pxTemp = pxService->pxCurrentTimerList;
+		pxService->pxCurrentTimerList = pxService->pxOverflowTimerList;
+		pxService->pxOverflowTimerList = pxTemp;
+	}
+	tmrEXIT_LIST_CRITICAL(); // [ILG]
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvCheckForValidListAndQueue( void )
 {
+TimerService_t *pxService; // [ILG]
+UBaseType_t uxService;
+
 	/* Check that the list from which active timers are referenced, and the
 	queue used to communicate with the timer service, have been
 	initialised. */
 	taskENTER_CRITICAL();
 	{
-		if( xTimerQueue == NULL )
+		if( xTimerServices[ 0 ].xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
-
-			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			// [ILG] Each timer service task has its own lists and queue.
+			for( uxService = 0U; uxService < ( UBaseType_t ) configTIMER_SERVICE_COUNT; uxService++ )
 			{
-				/* The timer queue is allocated statically in case
-				configSUPPORT_DYNAMIC_ALLOCATION is 0. */
-				static StaticQueue_t xStaticTimerQueue;
-				static uint8_t ucStaticTimerQueueStorage[ configTIMER_QUEUE_LENGTH * sizeof( DaemonTaskMessage_t ) ];
+				pxService = &( xTimerServices[ uxService ] );
+
+				vListInitialise( &( pxService->xActiveTimerList1 ) );
+				vListInitialise( &( pxService->xActiveTimerList2 ) );
+				pxService->pxCurrentTimerList = &( pxService->xActiveTimerList1 );
+				pxService->pxOverflowTimerList = &( pxService->xActiveTimerList2 );
+
+				// [ILG]
+				#if ( configUSE_TIMER_WHEEL == 1 )
+				{
+				UBaseType_t uxLevel, uxSlot;
+
+					for( uxLevel = 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+					{
+						for( uxSlot = 0U; uxSlot < tmrWHEEL_SLOTS; uxSlot++ )
+						{
+							vListInitialise( &( pxService->xTimerWheel[ uxLevel ][ uxSlot ] ) );
+						}
+					}
+					vListInitialise( &( pxService->xTimerWheelFarList ) );
+				}
+				#endif
+
+				#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+				{
+					/* The timer queue is allocated statically in case
+					configSUPPORT_DYNAMIC_ALLOCATION is 0. */
+					static StaticQueue_t xStaticTimerQueue[ configTIMER_SERVICE_COUNT ];
+					static uint8_t ucStaticTimerQueueStorage[ configTIMER_SERVICE_COUNT ][ configTIMER_QUEUE_LENGTH * sizeof( DaemonTaskMessage_t ) ];
+
+					pxService->xTimerQueue = xQueueCreateStatic( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ), &( ucStaticTimerQueueStorage[ uxService ][ 0 ] ), &( xStaticTimerQueue[ uxService ] ) );
+				}
+				#else
+				{
+					pxService->xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
+				}
+				#endif
 
-				xTimerQueue = xQueueCreateStatic( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ), &( ucStaticTimerQueueStorage[ 0 ] ), &xStaticTimerQueue );
+				#if ( configQUEUE_REGISTRY_SIZE > 0 )
+				{
+					if( pxService->xTimerQueue != NULL )
+					{
+						vQueueAddToRegistry( pxService->xTimerQueue, "TmrQ" );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configQUEUE_REGISTRY_SIZE */
 			}
-			#else
+
+			// [ILG]
+			#if ( configUSE_TICK_TIMERS == 1 )
 			{
-				xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
+				vListInitialise( &xTickTimerList1 );
+				vListInitialise( &xTickTimerList2 );
+				pxCurrentTickTimerList = &xTickTimerList1;
+				pxOverflowTickTimerList = &xTickTimerList2;
 			}
 			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configTIMER_SERVICE_COUNT > 1 )
+
+	void vTimerSetService( TimerHandle_t xTimer, const UBaseType_t uxService )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+
+		configASSERT( xTimer );
+		configASSERT( uxService < ( UBaseType_t ) configTIMER_SERVICE_COUNT );
+
+		taskENTER_CRITICAL();
+		{
+			/* The timer must be dormant, as it is held in the lists of the
+			service it is bound to, and that service must have processed every
+			command sent for the timer, or it would process them after the
+			timer moved, and put the timer in its own lists again. */
+			configASSERT( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) != pdFALSE );
+			configASSERT( pxTimer->uxCommandsPending == ( UBaseType_t ) 0U );
+
+			pxTimer->uxTimerService = uxService;
+		}
+		taskEXIT_CRITICAL();
+	}
+/*-----------------------------------------------------------*/
+
+	static void prvCountPendingCommand( Timer_t * const pxTimer, const BaseType_t xFromISR, const BaseType_t xAdd )
+	{
+	UBaseType_t uxSavedInterruptStatus = 0;
+
+		/* Commands are sent from tasks and interrupts, and processed by the
+		timer service task. */
+		if( xFromISR != pdFALSE )
+		{
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		}
+		else
+		{
+			taskENTER_CRITICAL();
+		}
+
+		if( xAdd != pdFALSE )
+		{
+			( pxTimer->uxCommandsPending )++;
+		}
+		else
+		{
+			configASSERT( pxTimer->uxCommandsPending > ( UBaseType_t ) 0U );
+			( pxTimer->uxCommandsPending )--;
+		}
+
+		if( xFromISR != pdFALSE )
+		{
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			taskEXIT_CRITICAL();
+		}
+	}
+
+#endif /* configTIMER_SERVICE_COUNT */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configUSE_TIMER_SLACK == 1 )
+
+	void vTimerSetSlack( TimerHandle_t xTimer, const TickType_t xSlackInTicks )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+
+		configASSERT( xTimer );
+		configASSERT( xSlackInTicks < ( portMAX_DELAY >> 1 ) );
+
+		/* The timer must be dormant, as the timer service task may be blocked
+		until a time calculated from the slack of the active timers. */
+		configASSERT( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) != pdFALSE );
+
+		pxTimer->xTimerSlack = xSlackInTicks;
+	}
+
+#endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
+// [ILG]
+#if ( configUSE_TICK_TIMERS == 1 )
+
+	void vTimerSetTickContext( TimerHandle_t xTimer, const UBaseType_t uxTickContext )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+
+		configASSERT( xTimer );
+
+		/* The timer must be dormant, as the lists it is held in depend on the
+		context its callback is called from. */
+		configASSERT( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) != pdFALSE );
+
+		pxTimer->ucTickContext = ( uxTickContext != ( UBaseType_t ) pdFALSE ) ? ( uint8_t ) pdTRUE : ( uint8_t ) pdFALSE;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvInsertTickTimer( Timer_t * const pxTimer, const TickType_t xNextExpiryTime )
+	{
+		listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
+		listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+		if( xNextExpiryTime <= xTickTimersTime )
+		{
+			/* The expiry time overflowed.  The period cannot be zero. */
+			vListInsert( pxOverflowTickTimerList, &( pxTimer->xTimerListItem ) );
+		}
+		else
+		{
+			vListInsert( pxCurrentTickTimerList, &( pxTimer->xTimerListItem ) );
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvTickTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue )
+	{
+	UBaseType_t uxSavedInterruptStatus = 0;
+	BaseType_t xReturn = pdPASS;
+
+		if( xCommandID >= tmrFIRST_FROM_ISR_COMMAND )
+		{
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		}
+		else
+		{
+			taskENTER_CRITICAL();
+		}
+
+		if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+		{
+			( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		switch( xCommandID )
+		{
+			case tmrCOMMAND_CHANGE_PERIOD :
+			case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+				pxTimer->xTimerPeriodInTicks = xOptionalValue;
+				configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+				/* Falls through. */
+
+			case tmrCOMMAND_START :
+			case tmrCOMMAND_START_FROM_ISR :
+			case tmrCOMMAND_RESET :
+			case tmrCOMMAND_RESET_FROM_ISR :
+			case tmrCOMMAND_START_DONT_TRACE :
+				/* The timer is started relative to the last tick processed,
+				which is the current tick, even while the scheduler is
+				suspended. */
+				prvInsertTickTimer( pxTimer, xTickTimersTime + pxTimer->xTimerPeriodInTicks );
+				break;
+
+			case tmrCOMMAND_STOP :
+			case tmrCOMMAND_STOP_FROM_ISR :
+				/* The timer has already been removed from the active list. */
+				break;
+
+			case tmrCOMMAND_DELETE :
+				/* Only removed from the active list here.  The memory is freed
+				by the timer service task. */
+				xReturn = pdFAIL;
+				break;
+
+			default :
+				/* Don't expect to get here. */
+				break;
+		}
+
+		if( xCommandID >= tmrFIRST_FROM_ISR_COMMAND )
+		{
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			taskEXIT_CRITICAL();
+		}
+
+		if( xReturn != pdFAIL )
+		{
+			traceTIMER_COMMAND_SEND( pxTimer, xCommandID, xOptionalValue, xReturn );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTimerProcessTickTimers( const TickType_t xTimeNow )
+	{
+	Timer_t *pxTimer;
+	List_t *pxTemp;
+	#if ( configTICK_TIMER_MAX_RUN_TIME > 0 )
+		uint32_t ulCallbackStart;
+	#endif
+
+		xTickTimersTime = xTimeNow;
+
+		if( pxCurrentTickTimerList != NULL )
+		{
+			if( xTimeNow == ( TickType_t ) 0U )
+			{
+				/* The tick count overflowed.  Every timer in the current list
+				expired before it did. */
+				pxTemp = pxCurrentTickTimerList;
+				pxCurrentTickTimerList = pxOverflowTickTimerList;
+				pxOverflowTickTimerList = pxTemp;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-			#if ( configQUEUE_REGISTRY_SIZE > 0 )
+			while( ( listLIST_IS_EMPTY( pxCurrentTickTimerList ) == pdFALSE ) && ( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTickTimerList ) <= xTimeNow ) )
 			{
-				if( xTimerQueue != NULL )
+				pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTickTimerList );
+				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				traceTIMER_EXPIRED( pxTimer );
+
+				if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
 				{
-					vQueueAddToRegistry( xTimerQueue, "TmrQ" );
+					prvInsertTickTimer( pxTimer, xTimeNow + pxTimer->xTimerPeriodInTicks );
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+
+				#if ( configTICK_TIMER_MAX_RUN_TIME > 0 )
+				{
+					ulCallbackStart = portGET_RUN_TIME_COUNTER_VALUE();
+				}
+				#endif
+
+				/* Called from the tick interrupt, so only interrupt safe API
+				functions can be used. */
+	#if defined(configUSE_CMSIS_PLUS)
+				pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer->pvTimerID );
+	#else
+				pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+	#endif
+
+				#if ( configTICK_TIMER_MAX_RUN_TIME > 0 )
+				{
+					/* The callback ran for longer than it is allowed to. */
+					configASSERT( ( uint32_t ) ( portGET_RUN_TIME_COUNTER_VALUE() - ulCallbackStart ) <= ( uint32_t ) configTICK_TIMER_MAX_RUN_TIME );
+				}
+				#endif
 			}
-			#endif /* configQUEUE_REGISTRY_SIZE */
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
 	}
-	taskEXIT_CRITICAL();
-}
+
+#endif /* configUSE_TICK_TIMERS */
 /*-----------------------------------------------------------*/
 
 BaseType_t xTimerIsTimerActive( TimerHandle_t xTimer )
@@ -1049,7 +2579,7 @@ Timer_t * const pxTimer = ( Timer_t * ) xTimer;
 		xMessage.u.xCallbackParameters.pvParameter1 = pvParameter1;
 		xMessage.u.xCallbackParameters.ulParameter2 = ulParameter2;
 
-		xReturn = xQueueSendFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+		xReturn = xQueueSendFromISR( xTimerServices[ 0 ].xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
 
 		tracePEND_FUNC_CALL_FROM_ISR( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
 
@@ -1069,7 +2599,7 @@ Timer_t * const pxTimer = ( Timer_t * ) xTimer;
 		/* This function can only be called after a timer has been created or
 		after the scheduler has been started because, until then, the timer
 		queue does not exist. */
-		configASSERT( xTimerQueue );
+		configASSERT( xTimerServices[ 0 ].xTimerQueue );
 
 		/* Complete the message with the function parameters and post it to the
 		daemon task. */
@@ -1078,7 +2608,7 @@ Timer_t * const pxTimer = ( Timer_t * ) xTimer;
 		xMessage.u.xCallbackParameters.pvParameter1 = pvParameter1;
 		xMessage.u.xCallbackParameters.ulParameter2 = ulParameter2;
 
-		xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+		xReturn = xQueueSendToBack( xTimerServices[ 0 ].xTimerQueue, &xMessage, xTicksToWait );
 
 		tracePEND_FUNC_CALL( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
 
@@ -95,7 +95,15 @@ typedef struct os_timer_port_data_s
 typedef struct os_mutex_port_data_s
 {
   void* handle;
+#if (configUSE_FAST_MUTEXES == 1)
+  union
+  {
+    StaticSemaphore_t mutex;
+    StaticFastMutex_t fast_mutex;
+  };
+#else
   StaticSemaphore_t mutex;
+#endif
 } os_mutex_port_data_t;
 
 #endif /* OS_USE_RTOS_PORT_MUTEX */
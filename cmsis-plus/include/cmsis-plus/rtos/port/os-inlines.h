@@ -194,6 +194,94 @@ namespace os
           return (__get_IPSR () != 0);
         }
 
+        // Tags selecting at compile time the context code runs in,
+        // so that code which knows it does not pay for the IPSR test.
+        namespace context
+        {
+          // Thread mode; critical sections nest and may call the kernel.
+          struct thread
+          {
+          };
+
+          // Interrupt handler; the previous mask is saved and restored.
+          struct handler
+          {
+          };
+
+          // Thread mode, outside any other critical section, with no
+          // kernel call inside (it would end the section early). There
+          // is no nesting count and no mask to save; on Cortex-M3/M4
+          // entering writes BASEPRI and exiting clears it.
+          struct unnested
+          {
+          };
+        } /* namespace context */
+
+        template<typename Context_T>
+          class critical_section_in;
+
+        template<>
+          class critical_section_in<context::thread>
+          {
+          public:
+
+            inline static rtos::interrupts::state_t
+            __attribute__((always_inline))
+            enter (void)
+            {
+              taskENTER_CRITICAL();
+              return 0;
+            }
+
+            inline static void
+            __attribute__((always_inline))
+            exit (rtos::interrupts::state_t status __attribute__((unused)))
+            {
+              taskEXIT_CRITICAL();
+            }
+          };
+
+        template<>
+          class critical_section_in<context::handler>
+          {
+          public:
+
+            inline static rtos::interrupts::state_t
+            __attribute__((always_inline))
+            enter (void)
+            {
+              return portSET_INTERRUPT_MASK_FROM_ISR();
+            }
+
+            inline static void
+            __attribute__((always_inline))
+            exit (rtos::interrupts::state_t status)
+            {
+              portCLEAR_INTERRUPT_MASK_FROM_ISR(status);
+            }
+          };
+
+        template<>
+          class critical_section_in<context::unnested>
+          {
+          public:
+
+            inline static rtos::interrupts::state_t
+            __attribute__((always_inline))
+            enter (void)
+            {
+              portDISABLE_INTERRUPTS();
+              return 0;
+            }
+
+            inline static void
+            __attribute__((always_inline))
+            exit (rtos::interrupts::state_t status __attribute__((unused)))
+            {
+              portENABLE_INTERRUPTS();
+            }
+          };
+
         // Enter an IRQ critical section
         inline rtos::interrupts::state_t
         __attribute__((always_inline))
@@ -201,28 +289,26 @@ namespace os
         {
           if (!interrupts::in_handler_mode ())
             {
-              taskENTER_CRITICAL();
-              return 0;
+              return critical_section_in<context::thread>::enter ();
             }
           else
             {
-              return portSET_INTERRUPT_MASK_FROM_ISR();
+              return critical_section_in<context::handler>::enter ();
             }
         }
 
         // Exit an IRQ critical section
         inline void
         __attribute__((always_inline))
-        critical_section::exit (
-            rtos::interrupts::state_t status __attribute__((unused)))
+        critical_section::exit (rtos::interrupts::state_t status)
         {
           if (!interrupts::in_handler_mode ())
             {
-              taskEXIT_CRITICAL();
+              critical_section_in<context::thread>::exit (status);
             }
           else
             {
-              portCLEAR_INTERRUPT_MASK_FROM_ISR(status);
+              critical_section_in<context::handler>::exit (status);
             }
         }
 
@@ -326,6 +412,16 @@ namespace os
         __attribute__((always_inline))
         thread (void)
         {
+#if (configUSE_TASK_OBJECT_POINTER == 1)
+          // Read directly from the current TCB, there is no TCB
+          // before the first thread is created. Tasks not created
+          // by the port (idle, timers) have a null pointer.
+          if (pxCurrentTCB == nullptr)
+            {
+              return nullptr;
+            }
+          return static_cast<rtos::thread*> (taskGET_CURRENT_OBJECT_POINTER ());
+#else
           TaskHandle_t th = xTaskGetCurrentTaskHandle ();
           if (th == nullptr)
             {
@@ -333,6 +429,7 @@ namespace os
             }
           void* p = pvTaskGetThreadLocalStoragePointer (th, 0);
           return ((rtos::thread*) p);
+#endif
         }
 
         inline void
@@ -366,6 +463,20 @@ namespace os
         return fr_prio;
       }
 
+      inline unsigned portBASE_TYPE
+      makeFreeRtosCeiling (rtos::thread::priority_t priority)
+      {
+        unsigned portBASE_TYPE fr_prio = makeFreeRtosPriority (priority);
+
+        // The default ceiling is the highest CMSIS++ priority, which
+        // may be above the kernel range.
+        if (fr_prio >= configMAX_PRIORITIES)
+          {
+            fr_prio = configMAX_PRIORITIES - 1;
+          }
+        return fr_prio;
+      }
+
       inline rtos::thread::priority_t
       makeCmsisPriority (unsigned portBASE_TYPE priority)
       {
@@ -413,9 +524,15 @@ namespace os
             // Remember pointer to implementation.
             obj->port_.handle = th;
 
+#if (configUSE_TASK_OBJECT_POINTER == 1)
+            // Store the pointer to this thread in the TCB, where
+            // this_thread::thread() reads it inline.
+            vTaskSetObjectPointer (th, obj);
+#else
             // Store the pointer to this thread as index 0 in the FreeRTOS
             // local storage pointers.
             vTaskSetThreadLocalStoragePointer (th, 0, obj);
+#endif
 #if defined(OS_TRACE_RTOS_THREAD)
             trace::printf ("port::thread::%s()=%p @%p %s\n", __func__, th, obj,
                            obj->name ());
@@ -473,10 +590,9 @@ namespace os
           }
         else
           {
+            // The kernel yields if the resumed thread has a priority
+            // at least equal to the running thread, and only then.
             vTaskGenericResume (obj->port_.handle);
-            // trace_putchar('^');
-            taskYIELD()
-            ;
           }
       }
 
@@ -496,14 +612,14 @@ namespace os
       thread::priority (rtos::thread* obj, rtos::thread::priority_t prio)
       {
         UBaseType_t fr_prio = makeFreeRtosPriority (prio);
+#if defined(OS_TRACE_RTOS_THREAD)
         trace::printf ("port::thread::%s() %p %s -> vTaskPrioritySet(%d)\n", __func__, obj,
                        obj->name (), fr_prio);
+#endif
+        // The kernel yields if the running thread lowered its own
+        // priority, or raised another thread above it.
         vTaskPrioritySet (obj->port_.handle, fr_prio);
 
-        // The manual says it is done, but apparently still needed.
-        taskYIELD()
-        ;
-
         return result::ok;
       }
 
@@ -556,6 +672,23 @@ namespace os
         __attribute__((always_inline))
         start (rtos::timer* obj, clock::duration_t ticks)
         {
+#if (configUSE_TIMER_DIRECT_COMMANDS == 1)
+          // Update the active timers list in place, without waking
+          // the timer daemon.
+          BaseType_t ret;
+          if (xTimerIsTimerActive (obj->port_.handle) != pdFALSE)
+            {
+              ret = xTimerResetDirect(obj->port_.handle);
+            }
+          else
+            {
+              ret = xTimerChangePeriodDirect(obj->port_.handle, ticks);
+            }
+          if (ret != pdPASS)
+            {
+              return ENOTRECOVERABLE;
+            }
+#else
           if (xTimerIsTimerActive (obj->port_.handle) != pdFALSE)
             {
               if (xTimerReset(obj->port_.handle, 0) != pdPASS)
@@ -577,6 +710,7 @@ namespace os
                     }
                 }
             }
+#endif
           return result::ok;
         }
 
@@ -590,7 +724,11 @@ namespace os
             }
           else
             {
+#if (configUSE_TIMER_DIRECT_COMMANDS == 1)
+              if (xTimerStopDirect(obj->port_.handle) != pdPASS)
+#else
               if (xTimerStop(obj->port_.handle, 0) != pdPASS)
+#endif
                 {
                   return ENOTRECOVERABLE;
                 }
@@ -611,10 +749,64 @@ namespace os
       {
       public:
 
+        inline static bool
+        __attribute__((always_inline))
+        is_fast (const rtos::mutex* obj __attribute__((unused)))
+        {
+#if (configUSE_FAST_MUTEXES == 1)
+          // Recursive mutexes keep a count and ceiling mutexes raise the
+          // owner on each lock, both need the queue based mutex.
+          return (obj->type_ != rtos::mutex::type::recursive)
+              && (obj->protocol_ != rtos::mutex::protocol::protect);
+#else
+          return false;
+#endif
+        }
+
+        inline static bool
+        __attribute__((always_inline))
+        is_above_ceiling (const rtos::mutex* obj)
+        {
+          // POSIX requires EINVAL when the base priority of the caller is
+          // above the ceiling; the kernel would otherwise assert.
+          return (obj->protocol_ == rtos::mutex::protocol::protect)
+              && (uxTaskBasePriorityGet (nullptr)
+                  > makeFreeRtosCeiling (obj->prio_ceiling_));
+        }
+
+        inline static BaseType_t
+        __attribute__((always_inline))
+        take (rtos::mutex* obj, TickType_t ticks)
+        {
+#if (configUSE_FAST_MUTEXES == 1)
+          if (is_fast (obj))
+            {
+              // Uncontended, this is a single compare and swap.
+              return xSemaphoreTakeFastMutex(obj->port_.handle, ticks);
+            }
+#endif
+          if (obj->type_ == rtos::mutex::type::recursive)
+            {
+              return xSemaphoreTakeRecursive(obj->port_.handle, ticks);
+            }
+          else
+            {
+              return xSemaphoreTake(obj->port_.handle, ticks);
+            }
+        }
+
         inline static void
         __attribute__((always_inline))
         create (rtos::mutex* obj)
         {
+#if (configUSE_FAST_MUTEXES == 1)
+          if (is_fast (obj))
+            {
+              obj->port_.handle = xSemaphoreCreateFastMutexStatic(
+                  &obj->port_.fast_mutex);
+              return;
+            }
+#endif
           if (obj->type_ == rtos::mutex::type::recursive)
             {
               obj->port_.handle = xSemaphoreCreateRecursiveMutexStatic(
@@ -625,12 +817,26 @@ namespace os
               obj->port_.handle = xSemaphoreCreateMutexStatic(
                   &obj->port_.mutex);
             }
+
+          if (obj->protocol_ == rtos::mutex::protocol::protect)
+            {
+              // Immediate priority ceiling, the owner is raised on lock.
+              vSemaphoreSetPriorityCeiling (
+                  obj->port_.handle, makeFreeRtosCeiling (obj->prio_ceiling_));
+            }
         }
 
         inline static void
         __attribute__((always_inline))
         destroy (rtos::mutex* obj)
         {
+#if (configUSE_FAST_MUTEXES == 1)
+          if (is_fast (obj))
+            {
+              vSemaphoreDeleteFastMutex(obj->port_.handle);
+              return;
+            }
+#endif
           vSemaphoreDelete(obj->port_.handle);
         }
 
@@ -638,22 +844,18 @@ namespace os
         __attribute__((always_inline))
         lock (rtos::mutex* obj)
         {
-          BaseType_t res;
-
-          if (obj->type_ == rtos::mutex::type::recursive)
-            {
-              res = xSemaphoreTakeRecursive(obj->port_.handle, portMAX_DELAY);
-            }
-          else
+          if (is_above_ceiling (obj))
             {
-              res = xSemaphoreTake(obj->port_.handle, portMAX_DELAY);
+              return EINVAL;
             }
 
-          if (res != pdTRUE)
+          if (take (obj, portMAX_DELAY) != pdTRUE)
             {
               return ENOTRECOVERABLE;
             }
 
+          // The shadow owner and count are only written by the thread
+          // holding the mutex, while holding it, so they need no lock.
           obj->owner_ = &rtos::this_thread::thread ();
           ++obj->count_;
           return result::ok;
@@ -663,18 +865,12 @@ namespace os
         __attribute__((always_inline))
         try_lock (rtos::mutex* obj)
         {
-          BaseType_t res;
-
-          if (obj->type_ == rtos::mutex::type::recursive)
+          if (is_above_ceiling (obj))
             {
-              res = xSemaphoreTakeRecursive(obj->port_.handle, 0);
-            }
-          else
-            {
-              res = xSemaphoreTake(obj->port_.handle, 0);
+              return EINVAL;
             }
 
-          if (res != pdTRUE)
+          if (take (obj, 0) != pdTRUE)
             {
               return EWOULDBLOCK;
             }
@@ -688,23 +884,17 @@ namespace os
         __attribute__((always_inline))
         timed_lock (rtos::mutex* obj, clock::duration_t ticks)
         {
-          BaseType_t res;
-
-          if (ticks == 0)
+          if (is_above_ceiling (obj))
             {
-              ticks = 1;
+              return EINVAL;
             }
 
-          if (obj->type_ == rtos::mutex::type::recursive)
-            {
-              res = xSemaphoreTakeRecursive(obj->port_.handle, ticks);
-            }
-          else
+          if (ticks == 0)
             {
-              res = xSemaphoreTake(obj->port_.handle, ticks);
+              ticks = 1;
             }
 
-          if (res != pdTRUE)
+          if (take (obj, ticks) != pdTRUE)
             {
               return ETIMEDOUT;
             }
@@ -719,12 +909,27 @@ namespace os
         unlock (rtos::mutex* obj)
         {
           BaseType_t res;
+          rtos::thread* owner = obj->owner_;
 
-          if (obj->owner_ != &rtos::this_thread::thread ())
+          if (owner != &rtos::this_thread::thread ())
             {
               return EPERM;
             }
 
+          // Update the shadow state while still holding the mutex.
+          --obj->count_;
+          if (obj->count_ == 0)
+            {
+              obj->owner_ = nullptr;
+            }
+
+#if (configUSE_FAST_MUTEXES == 1)
+          if (is_fast (obj))
+            {
+              res = xSemaphoreGiveFastMutex(obj->port_.handle);
+            }
+          else
+#endif
           if (obj->type_ == rtos::mutex::type::recursive)
             {
               res = xSemaphoreGiveRecursive(obj->port_.handle);
@@ -736,15 +941,12 @@ namespace os
 
           if (res != pdTRUE)
             {
+              // The kernel still has the mutex held by this thread.
+              ++obj->count_;
+              obj->owner_ = owner;
               return ENOTRECOVERABLE;
             }
 
-          --obj->count_;
-          if (obj->count_ == 0)
-            {
-              obj->owner_ = nullptr;
-            }
-
           return result::ok;
         }
 
@@ -760,13 +962,16 @@ namespace os
         prio_ceiling (rtos::mutex* obj, rtos::thread::priority_t prio_ceiling,
                       rtos::thread::priority_t* old_prio_ceiling)
         {
-          rtos::thread::priority_t prio;
+          rtos::thread::priority_t prio = obj->prio_ceiling_;
+
+          // The kernel updates the ceiling atomically, there is no need
+          // to lock the mutex, which would raise the caller to the old
+          // ceiling.
+          obj->prio_ceiling_ = prio_ceiling;
+          if (obj->protocol_ == rtos::mutex::protocol::protect)
             {
-              // TODO: lock() must not adhere to the priority protocol.
-              obj->lock ();
-              prio = obj->prio_ceiling_;
-              obj->prio_ceiling_ = prio_ceiling;
-              obj->unlock ();
+              vSemaphoreSetPriorityCeiling (
+                  obj->port_.handle, makeFreeRtosCeiling (prio_ceiling));
             }
 
           if (old_prio_ceiling != nullptr)
@@ -806,6 +1011,26 @@ namespace os
       {
       public:
 
+        // The kernel owns the count; the shadow copy read by
+        // rtos::semaphore::value() is refreshed from it after each
+        // operation, instead of being incremented outside any critical
+        // section, which loses updates when threads and interrupts
+        // race. The count is read and stored in one critical section,
+        // so an interrupt cannot store a newer count in between that
+        // would then be overwritten by the older one.
+        template<typename Context_T>
+          inline static void
+          __attribute__((always_inline))
+          update_count (rtos::semaphore* obj)
+          {
+            rtos::interrupts::state_t status = interrupts::critical_section_in<
+                Context_T>::enter ();
+            obj->count_ =
+                static_cast<rtos::semaphore::count_t> (uxQueueMessagesWaitingFromISR (
+                    obj->port_.handle));
+            interrupts::critical_section_in<Context_T>::exit (status);
+          }
+
         inline static void
         __attribute__((always_inline))
         create (rtos::semaphore* obj)
@@ -826,6 +1051,8 @@ namespace os
           vSemaphoreDelete(obj->port_.handle);
         }
 
+        // Callers that know their context can call the tagged
+        // variants directly and skip the IPSR test.
         inline static result_t
         __attribute__((always_inline))
         post (rtos::semaphore* obj)
@@ -836,29 +1063,48 @@ namespace os
               return EOVERFLOW;
             }
 #endif
-          portBASE_TYPE thread_woken = pdFALSE;
-
           if (rtos::interrupts::in_handler_mode ())
             {
-              if (xSemaphoreGiveFromISR(obj->port_.handle,
-                  &thread_woken) != pdTRUE)
-                {
-                  return EAGAIN;
-                }
-              portEND_SWITCHING_ISR(thread_woken);
+              return post (obj, interrupts::context::handler ());
             }
           else
             {
-              if (xSemaphoreGive (obj->port_.handle) != pdTRUE)
-                {
-                  return EAGAIN;
-                }
+              return post (obj, interrupts::context::thread ());
+            }
+        }
+
+        inline static result_t
+        __attribute__((always_inline))
+        post (rtos::semaphore* obj, interrupts::context::thread)
+        {
+          if (xSemaphoreGive (obj->port_.handle) != pdTRUE)
+            {
+              return EAGAIN;
             }
-          ++(obj->count_);
+          update_count<interrupts::context::thread> (obj);
 
           return result::ok;
         }
 
+        inline static result_t
+        __attribute__((always_inline))
+        post (rtos::semaphore* obj, interrupts::context::handler)
+        {
+          portBASE_TYPE thread_woken = pdFALSE;
+
+          if (xSemaphoreGiveFromISR(obj->port_.handle,
+              &thread_woken) != pdTRUE)
+            {
+              return EAGAIN;
+            }
+          update_count<interrupts::context::handler> (obj);
+          portEND_SWITCHING_ISR(thread_woken);
+
+          return result::ok;
+        }
+
+        // Blocking calls are made from threads outside any critical
+        // section, so the count is refreshed with the unnested one.
         inline static result_t
         __attribute__((always_inline))
         wait (rtos::semaphore* obj)
@@ -867,7 +1113,7 @@ namespace os
             {
               return ENOTRECOVERABLE;
             }
-          --(obj->count_);
+          update_count<interrupts::context::unnested> (obj);
 
           return result::ok;
         }
@@ -876,23 +1122,43 @@ namespace os
         __attribute__((always_inline))
         try_wait (rtos::semaphore* obj)
         {
-          portBASE_TYPE thread_woken = pdFALSE;
-
           if (rtos::interrupts::in_handler_mode ())
             {
-              if (xSemaphoreTakeFromISR(obj->port_.handle,
-                  &thread_woken) != pdTRUE)
-                {
-                  return EWOULDBLOCK;
-                }
-              portEND_SWITCHING_ISR(thread_woken);
+              return try_wait (obj, interrupts::context::handler ());
+            }
+          else
+            {
+              return try_wait (obj, interrupts::context::thread ());
+            }
+        }
+
+        inline static result_t
+        __attribute__((always_inline))
+        try_wait (rtos::semaphore* obj, interrupts::context::thread)
+        {
+          if (xSemaphoreTake (obj->port_.handle, 0) != pdTRUE)
+            {
+              return EWOULDBLOCK;
             }
-          else if (xSemaphoreTake (obj->port_.handle, 0) != pdTRUE)
+
+          update_count<interrupts::context::thread> (obj);
+          return result::ok;
+        }
+
+        inline static result_t
+        __attribute__((always_inline))
+        try_wait (rtos::semaphore* obj, interrupts::context::handler)
+        {
+          portBASE_TYPE thread_woken = pdFALSE;
+
+          if (xSemaphoreTakeFromISR(obj->port_.handle,
+              &thread_woken) != pdTRUE)
             {
               return EWOULDBLOCK;
             }
 
-          --(obj->count_);
+          update_count<interrupts::context::handler> (obj);
+          portEND_SWITCHING_ISR(thread_woken);
           return result::ok;
         }
 
@@ -912,7 +1178,7 @@ namespace os
               return ETIMEDOUT;
             }
 
-          --(obj->count_);
+          update_count<interrupts::context::unnested> (obj);
           return result::ok;
         }
 
@@ -920,16 +1186,15 @@ namespace os
         __attribute__((always_inline))
         reset (rtos::semaphore* obj)
         {
-          if (obj->count_ < 0)
+          // The kernel sets the count in one critical section, and
+          // refuses while threads are blocked waiting.
+          if (xSemaphoreResetCount (obj->port_.handle,
+                                    obj->initial_value_) != pdPASS)
             {
-              // There are waiting tasks
               return EAGAIN;
             }
 
-          // TODO: Check if this properly resets a semaphore.
-          xQueueReset(obj->port_.handle);
-
-          obj->count_ = obj->initial_value_;
+          update_count<interrupts::context::thread> (obj);
           return result::ok;
         }
 
@@ -958,6 +1223,23 @@ namespace os
       {
       public:
 
+        // As for semaphores, the shadow count read by
+        // rtos::message_queue::length() is refreshed from the kernel,
+        // in one critical section; the blocking calls use the unnested
+        // one, the others the one of their context.
+        template<typename Context_T>
+          inline static void
+          __attribute__((always_inline))
+          update_count (rtos::message_queue* obj)
+          {
+            rtos::interrupts::state_t status = interrupts::critical_section_in<
+                Context_T>::enter ();
+            obj->count_ =
+                static_cast<rtos::message_queue::size_t> (uxQueueMessagesWaitingFromISR (
+                    obj->port_.handle));
+            interrupts::critical_section_in<Context_T>::exit (status);
+          }
+
         inline static void
         __attribute__((always_inline))
         create (rtos::message_queue* obj)
@@ -988,36 +1270,61 @@ namespace os
               return ENOTRECOVERABLE;
             }
 
-          ++(obj->count_);
+          update_count<interrupts::context::unnested> (obj);
           return result::ok;
         }
 
         inline static result_t
         __attribute__((always_inline))
         try_send (rtos::message_queue* obj, const void* msg,
-                  std::size_t nbytes __attribute__((unused)),
-                  rtos::message_queue::priority_t mprio __attribute__((unused)))
+                  std::size_t nbytes,
+                  rtos::message_queue::priority_t mprio)
         {
-          portBASE_TYPE thread_woken = pdFALSE;
-
           if (rtos::interrupts::in_handler_mode ())
             {
-              if (xQueueSendFromISR(obj->port_.handle, msg,
-                  &thread_woken) != pdTRUE)
-                {
-                  return EWOULDBLOCK;
-                }
-              portEND_SWITCHING_ISR(thread_woken);
+              return try_send (obj, msg, nbytes, mprio,
+                               interrupts::context::handler ());
             }
           else
             {
-              if (xQueueSend (obj->port_.handle, msg, 0) != pdTRUE)
-                {
-                  return EWOULDBLOCK;
-                }
+              return try_send (obj, msg, nbytes, mprio,
+                               interrupts::context::thread ());
             }
+        }
 
-          ++(obj->count_);
+        inline static result_t
+        __attribute__((always_inline))
+        try_send (rtos::message_queue* obj, const void* msg,
+                  std::size_t nbytes __attribute__((unused)),
+                  rtos::message_queue::priority_t mprio __attribute__((unused)),
+                  interrupts::context::thread)
+        {
+          if (xQueueSend (obj->port_.handle, msg, 0) != pdTRUE)
+            {
+              return EWOULDBLOCK;
+            }
+
+          update_count<interrupts::context::thread> (obj);
+          return result::ok;
+        }
+
+        inline static result_t
+        __attribute__((always_inline))
+        try_send (rtos::message_queue* obj, const void* msg,
+                  std::size_t nbytes __attribute__((unused)),
+                  rtos::message_queue::priority_t mprio __attribute__((unused)),
+                  interrupts::context::handler)
+        {
+          portBASE_TYPE thread_woken = pdFALSE;
+
+          if (xQueueSendFromISR(obj->port_.handle, msg,
+              &thread_woken) != pdTRUE)
+            {
+              return EWOULDBLOCK;
+            }
+
+          update_count<interrupts::context::handler> (obj);
+          portEND_SWITCHING_ISR(thread_woken);
           return result::ok;
         }
 
@@ -1042,7 +1349,7 @@ namespace os
               return ETIMEDOUT;
             }
 
-          ++(obj->count_);
+          update_count<interrupts::context::unnested> (obj);
           return result::ok;
         }
 
@@ -1058,39 +1365,63 @@ namespace os
               return ENOTRECOVERABLE;
             }
 
-          --(obj->count_);
+          update_count<interrupts::context::unnested> (obj);
           return result::ok;
         }
 
         inline static result_t
         __attribute__((always_inline))
-        try_receive (
-            rtos::message_queue* obj, void* msg,
-            std::size_t nbytes __attribute__((unused)),
-            rtos::message_queue::priority_t* mprio __attribute__((unused)))
+        try_receive (rtos::message_queue* obj, void* msg, std::size_t nbytes,
+                     rtos::message_queue::priority_t* mprio)
         {
-          portBASE_TYPE thread_woken = pdFALSE;
-
           if (rtos::interrupts::in_handler_mode ())
             {
-              if (xQueueReceiveFromISR (obj->port_.handle, msg,
-                                        &thread_woken) != pdTRUE)
-                {
-                  return EWOULDBLOCK;
-                }
-              portEND_SWITCHING_ISR(thread_woken);
+              return try_receive (obj, msg, nbytes, mprio,
+                                  interrupts::context::handler ());
             }
           else
             {
-              if (xQueueReceive (obj->port_.handle, msg, 0) != pdTRUE)
-                {
-                  return EWOULDBLOCK;
-                }
+              return try_receive (obj, msg, nbytes, mprio,
+                                  interrupts::context::thread ());
             }
+        }
 
-          --(obj->count_);
+        inline static result_t
+        __attribute__((always_inline))
+        try_receive (
+            rtos::message_queue* obj, void* msg,
+            std::size_t nbytes __attribute__((unused)),
+            rtos::message_queue::priority_t* mprio __attribute__((unused)),
+            interrupts::context::thread)
+        {
+          if (xQueueReceive (obj->port_.handle, msg, 0) != pdTRUE)
+            {
+              return EWOULDBLOCK;
+            }
+
+          update_count<interrupts::context::thread> (obj);
           return result::ok;
+        }
 
+        inline static result_t
+        __attribute__((always_inline))
+        try_receive (
+            rtos::message_queue* obj, void* msg,
+            std::size_t nbytes __attribute__((unused)),
+            rtos::message_queue::priority_t* mprio __attribute__((unused)),
+            interrupts::context::handler)
+        {
+          portBASE_TYPE thread_woken = pdFALSE;
+
+          if (xQueueReceiveFromISR (obj->port_.handle, msg,
+                                    &thread_woken) != pdTRUE)
+            {
+              return EWOULDBLOCK;
+            }
+
+          update_count<interrupts::context::handler> (obj);
+          portEND_SWITCHING_ISR(thread_woken);
+          return result::ok;
         }
 
         inline static result_t
@@ -1112,7 +1443,7 @@ namespace os
               return ETIMEDOUT;
             }
 
-          --(obj->count_);
+          update_count<interrupts::context::unnested> (obj);
           return result::ok;
         }
 
@@ -1122,7 +1453,7 @@ namespace os
         {
           xQueueReset(obj->port_.handle);
 
-          obj->count_ = 0;
+          update_count<interrupts::context::thread> (obj);
           return result::ok;
         }
 
@@ -1158,8 +1489,7 @@ namespace os
         wait (rtos::event_flags* obj, flags::mask_t mask, flags::mask_t* oflags,
               flags::mode_t mode)
         {
-          // FreeRTOS uses only 24 bits.
-          mask &= 0xFFFFFF;
+          mask &= usable_mask;
 
           EventBits_t bits;
           if (mask != 0)
@@ -1172,7 +1502,7 @@ namespace os
             }
           else
             {
-              bits = xEventGroupWaitBits (obj->port_.handle, (0 - 1),
+              bits = xEventGroupWaitBits (obj->port_.handle, usable_mask,
               pdTRUE,
                                           pdFALSE, portMAX_DELAY);
             }
@@ -1183,56 +1513,68 @@ namespace os
           return result::ok;
         }
 
+        // Callers that know their context can call the tagged
+        // variants directly and skip the IPSR test.
         inline static result_t
         __attribute__((always_inline))
         try_wait (rtos::event_flags* obj, flags::mask_t mask,
                   flags::mask_t* oflags, flags::mode_t mode)
         {
-          // FreeRTOS uses only 24 bits.
-          mask &= 0xFFFFFF;
-
-          EventBits_t bits;
           if (rtos::interrupts::in_handler_mode ())
             {
-              bits = xEventGroupGetBitsFromISR (obj->port_.handle);
+              return try_wait (obj, mask, oflags, mode,
+                               interrupts::context::handler ());
             }
           else
             {
-              bits = xEventGroupGetBits(obj->port_.handle);
+              return try_wait (obj, mask, oflags, mode,
+                               interrupts::context::thread ());
             }
+        }
 
-          if ((mask != 0) && ((mode & flags::mode::all) != 0))
-            {
-              // Only if all desires signals are raised we're done.
-              if ((bits & mask) == mask)
-                {
-                  if (oflags != nullptr)
-                    {
-                      *oflags = bits;
-                    }
-                  // Clear desired signals.
-                  bits &= ~mask;
-                  return result::ok;
-                }
-            }
-          else if ((mask == 0) || ((mode & flags::mode::any) != 0))
-            {
-              // Any flag will do it.
-              if (bits != 0)
-                {
-                  // Possibly return.
-                  if (oflags != nullptr)
-                    {
-                      *oflags = bits;
-                    }
-                  // Since we returned them all, also clear them all.
-                  bits = 0;
-                  return result::ok;
-                }
-            }
+        template<typename Context_T>
+          inline static result_t
+          __attribute__((always_inline))
+          try_wait (rtos::event_flags* obj, flags::mask_t mask,
+                    flags::mask_t* oflags, flags::mode_t mode,
+                    Context_T context)
+          {
+            mask &= usable_mask;
 
-          return EWOULDBLOCK;
-        }
+            EventBits_t bits = get_bits (obj, context);
+
+            if ((mask != 0) && ((mode & flags::mode::all) != 0))
+              {
+                // Only if all desires signals are raised we're done.
+                if ((bits & mask) == mask)
+                  {
+                    if (oflags != nullptr)
+                      {
+                        *oflags = bits;
+                      }
+                    // Clear desired signals.
+                    bits &= ~mask;
+                    return result::ok;
+                  }
+              }
+            else if ((mask == 0) || ((mode & flags::mode::any) != 0))
+              {
+                // Any flag will do it.
+                if (bits != 0)
+                  {
+                    // Possibly return.
+                    if (oflags != nullptr)
+                      {
+                        *oflags = bits;
+                      }
+                    // Since we returned them all, also clear them all.
+                    bits = 0;
+                    return result::ok;
+                  }
+              }
+
+            return EWOULDBLOCK;
+          }
 
         inline static result_t
         __attribute__((always_inline))
@@ -1240,8 +1582,7 @@ namespace os
                     clock::duration_t ticks, flags::mask_t* oflags,
                     flags::mode_t mode)
         {
-          // FreeRTOS uses only 24 bits.
-          mask &= 0xFFFFFF;
+          mask &= usable_mask;
 
           EventBits_t bits;
           if (ticks == 0)
@@ -1258,7 +1599,7 @@ namespace os
             }
           else
             {
-              bits = xEventGroupWaitBits (obj->port_.handle, (0 - 1),
+              bits = xEventGroupWaitBits (obj->port_.handle, usable_mask,
               pdTRUE,
                                           pdFALSE, ticks);
             }
@@ -1275,27 +1616,24 @@ namespace os
         raise (rtos::event_flags* obj, flags::mask_t mask,
                flags::mask_t* oflags)
         {
-          // FreeRTOS uses only 24 bits.
-          mask &= 0xFFFFFF;
-
-          EventBits_t bits;
           if (rtos::interrupts::in_handler_mode ())
             {
-              portBASE_TYPE thread_woken = pdFALSE;
-
-              if (xEventGroupSetBitsFromISR (obj->port_.handle, mask,
-                                             &thread_woken) == pdFAIL)
-                {
-                  return ENOTRECOVERABLE;
-                }
-
-              bits = xEventGroupGetBitsFromISR (obj->port_.handle);
-              portEND_SWITCHING_ISR(thread_woken);
+              return raise (obj, mask, oflags, interrupts::context::handler ());
             }
           else
             {
-              bits = xEventGroupSetBits (obj->port_.handle, mask);
+              return raise (obj, mask, oflags, interrupts::context::thread ());
             }
+        }
+
+        inline static result_t
+        __attribute__((always_inline))
+        raise (rtos::event_flags* obj, flags::mask_t mask,
+               flags::mask_t* oflags, interrupts::context::thread)
+        {
+          mask &= usable_mask;
+
+          EventBits_t bits = xEventGroupSetBits (obj->port_.handle, mask);
 
           if (oflags != nullptr)
             {
@@ -1307,79 +1645,102 @@ namespace os
 
         inline static result_t
         __attribute__((always_inline))
-        clear (rtos::event_flags* obj, flags::mask_t mask,
-               flags::mask_t* oflags)
-        {          // FreeRTOS uses only 24 bits.
-          mask &= 0xFFFFFF;
+        raise (rtos::event_flags* obj, flags::mask_t mask,
+               flags::mask_t* oflags, interrupts::context::handler)
+        {
+          mask &= usable_mask;
 
-          EventBits_t bits;
-          if (rtos::interrupts::in_handler_mode ())
-            {
-              bits = xEventGroupClearBitsFromISR (obj->port_.handle, mask);
-            }
-          else
+          portBASE_TYPE thread_woken = pdFALSE;
+
+          if (xEventGroupSetBitsFromISR (obj->port_.handle, mask,
+                                         &thread_woken) == pdFAIL)
             {
-              bits = xEventGroupClearBits (obj->port_.handle, mask);
+              return ENOTRECOVERABLE;
             }
 
+          EventBits_t bits = xEventGroupGetBitsFromISR (obj->port_.handle);
+          portEND_SWITCHING_ISR(thread_woken);
+
           if (oflags != nullptr)
             {
               *oflags = bits;
             }
 
           return result::ok;
+        }
 
+        inline static result_t
+        __attribute__((always_inline))
+        clear (rtos::event_flags* obj, flags::mask_t mask,
+               flags::mask_t* oflags)
+        {
+          if (rtos::interrupts::in_handler_mode ())
+            {
+              return clear (obj, mask, oflags, interrupts::context::handler ());
+            }
+          else
+            {
+              return clear (obj, mask, oflags, interrupts::context::thread ());
+            }
         }
 
+        template<typename Context_T>
+          inline static result_t
+          __attribute__((always_inline))
+          clear (rtos::event_flags* obj, flags::mask_t mask,
+                 flags::mask_t* oflags, Context_T context)
+          {
+            mask &= usable_mask;
+
+            EventBits_t bits = clear_bits (obj, mask, context);
+
+            if (oflags != nullptr)
+              {
+                *oflags = bits;
+              }
+
+            return result::ok;
+          }
+
         inline static flags::mask_t
         __attribute__((always_inline))
         get (rtos::event_flags* obj, flags::mask_t mask, flags::mode_t mode)
         {
-          // FreeRTOS uses only 24 bits.
-          mask &= 0xFFFFFF;
-
-          EventBits_t bits;
-          flags::mask_t ret;
-
-          // FreeRTOS reserves some bits for system usage.
-          mask &= ~0xff000000UL;
           if (rtos::interrupts::in_handler_mode ())
             {
-              bits = xEventGroupGetBitsFromISR (obj->port_.handle);
-              if (mask == 0)
-                {
-                  // Return the entire mask.
-                  return bits;
-                }
-              ret = bits & mask;
-              if ((mode & flags::mode::clear) != 0)
-                {
-                  // Clear the selected bits; leave the rest untouched.
-                  xEventGroupClearBitsFromISR (obj->port_.handle,
-                                               ~mask & ~0xff000000UL);
-                }
+              return get (obj, mask, mode, interrupts::context::handler ());
             }
           else
             {
-              bits = xEventGroupGetBits(obj->port_.handle);
-              if (mask == 0)
-                {
-                  // Return the entire mask.
-                  return bits;
-                }
-              ret = bits & mask;
-              if ((mode & flags::mode::clear) != 0)
-                {
-                  // Clear the selected bits; leave the rest untouched.
-                  xEventGroupClearBits (obj->port_.handle,
-                                        ~mask & ~0xff000000UL);
-                }
+              return get (obj, mask, mode, interrupts::context::thread ());
             }
-
-          // Return the selected bits.
-          return ret;
         }
 
+        template<typename Context_T>
+          inline static flags::mask_t
+          __attribute__((always_inline))
+          get (rtos::event_flags* obj, flags::mask_t mask, flags::mode_t mode,
+               Context_T context)
+          {
+            mask &= usable_mask;
+
+            EventBits_t bits = get_bits (obj, context);
+            if (mask == 0)
+              {
+                // Return the entire mask.
+                return bits;
+              }
+            flags::mask_t ret = bits & mask;
+            if ((mode & flags::mode::clear) != 0)
+              {
+                // Clear the selected bits; leave the rest untouched.
+                clear_bits (obj, ~mask & usable_mask, context);
+              }
+
+            // Return the selected bits.
+            return ret;
+          }
+
         inline static bool
         __attribute__((always_inline))
         waiting (rtos::event_flags* obj)
@@ -1388,6 +1749,50 @@ namespace os
           return xEventFlagsWaiting (obj->port_.handle);
         }
 
+        // --------------------------------------------------------------------
+
+      private:
+
+        inline static EventBits_t
+        __attribute__((always_inline))
+        get_bits (rtos::event_flags* obj, interrupts::context::thread)
+        {
+          return xEventGroupGetBits(obj->port_.handle);
+        }
+
+        inline static EventBits_t
+        __attribute__((always_inline))
+        get_bits (rtos::event_flags* obj, interrupts::context::handler)
+        {
+          return xEventGroupGetBitsFromISR (obj->port_.handle);
+        }
+
+        inline static EventBits_t
+        __attribute__((always_inline))
+        clear_bits (rtos::event_flags* obj, flags::mask_t mask,
+                    interrupts::context::thread)
+        {
+          return xEventGroupClearBits (obj->port_.handle, mask);
+        }
+
+        inline static EventBits_t
+        __attribute__((always_inline))
+        clear_bits (rtos::event_flags* obj, flags::mask_t mask,
+                    interrupts::context::handler)
+        {
+          return xEventGroupClearBitsFromISR (obj->port_.handle, mask);
+        }
+
+        // The event group bits available to the application; unless
+        // configUSE_FULL_EVENT_BITS is set, FreeRTOS reserves the
+        // top 8 bits for system usage.
+        static constexpr flags::mask_t usable_mask =
+#if (configUSE_FULL_EVENT_BITS == 1)
+            static_cast<flags::mask_t> (~0UL);
+#else
+            0xFFFFFF;
+#endif
+
         // --------------------------------------------------------------------
       };
 
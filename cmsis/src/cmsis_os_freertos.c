@@ -95,6 +95,14 @@
 extern void
 xPortSysTickHandler (void);
 
+// [ILG]
+// Signals use the last task notification slot, so that index 0 (used
+// by the single producer/consumer queues and by ulTaskNotifyTake()
+// based drivers) remains available when more than one slot is configured.
+#if !defined(osSignalNotifyIndex)
+#define osSignalNotifyIndex (configTASK_NOTIFICATION_ARRAY_ENTRIES - 1)
+#endif
+
 /* Convert from CMSIS type osPriority to FreeRTOS priority number */
 static unsigned portBASE_TYPE makeFreeRtosPriority (osPriority priority)
   {
@@ -393,7 +401,36 @@ osStatus
 osTimerStart (osTimerId timer_id, uint32_t millisec)
 {
   osStatus result = osOK;
-#if (configUSE_TIMERS == 1)  
+#if (configUSE_TIMERS == 1) && (configUSE_TIMER_DIRECT_COMMANDS == 1)
+  // Update the active timers list in place, without a message to
+  // the timer daemon.
+  portBASE_TYPE taskWoken = pdFALSE;
+  portBASE_TYPE ret;
+  TickType_t ticks = millisec / portTICK_PERIOD_MS;
+
+  if (ticks == 0)
+  ticks = 1;
+
+  if (xTimerIsTimerActive(timer_id) != pdFALSE)
+    {
+      if (inHandlerMode())
+      ret = xTimerResetDirectFromISR(timer_id, &taskWoken);
+      else
+      ret = xTimerResetDirect(timer_id);
+    }
+  else
+    {
+      if (inHandlerMode())
+      ret = xTimerChangePeriodDirectFromISR(timer_id, ticks, &taskWoken);
+      else
+      ret = xTimerChangePeriodDirect(timer_id, ticks);
+    }
+
+  if (ret != pdPASS)
+  result = osErrorOS;
+  else if (inHandlerMode())
+  portEND_SWITCHING_ISR(taskWoken);
+#elif (configUSE_TIMERS == 1)
   portBASE_TYPE taskWoken = pdFALSE;
   TickType_t ticks = millisec / portTICK_PERIOD_MS;
 
@@ -467,7 +504,11 @@ osTimerStop (osTimerId timer_id)
 
   if (inHandlerMode())
     {
+#if (configUSE_TIMER_DIRECT_COMMANDS == 1)
+      if (xTimerStopDirectFromISR(timer_id, &taskWoken) != pdPASS)
+#else
       if (xTimerStopFromISR(timer_id, &taskWoken) != pdPASS)
+#endif
         {
           return osErrorOS;
         }
@@ -475,7 +516,11 @@ osTimerStop (osTimerId timer_id)
     }
   else
     {
+#if (configUSE_TIMER_DIRECT_COMMANDS == 1)
+      if (xTimerStopDirect(timer_id) != pdPASS)
+#else
       if (xTimerStop(timer_id, 0) != pdPASS)
+#endif
         {
           result = osErrorOS;
         }
@@ -533,13 +578,15 @@ osSignalSet (osThreadId thread_id, int32_t signal)
 
   if (inHandlerMode ())
     {
-      if (xTaskNotifyFromISR (thread_id, (uint32_t) signal, eSetBits,
-                              &xHigherPriorityTaskWoken) != pdPASS)
+      if (xTaskNotifyIndexedFromISR (thread_id, osSignalNotifyIndex,
+                                     (uint32_t) signal, eSetBits,
+                                     &xHigherPriorityTaskWoken) != pdPASS)
         return osErrorOS;
 
       portYIELD_FROM_ISR (xHigherPriorityTaskWoken);
     }
-  else if (xTaskNotify (thread_id, (uint32_t) signal, eSetBits) != pdPASS)
+  else if (xTaskNotifyIndexed (thread_id, osSignalNotifyIndex,
+                               (uint32_t) signal, eSetBits) != pdPASS)
     {
       return osErrorOS;
     }
@@ -557,8 +604,15 @@ osSignalSet (osThreadId thread_id, int32_t signal)
 int32_t
 osSignalClear (osThreadId thread_id, int32_t signal)
 {
-  /* not implemented yet (LNP) */
-  return 0;
+  // [ILG]
+  if ((thread_id == NULL) || inHandlerMode ())
+    {
+      return (int32_t) 0x80000000;
+    }
+
+  return (int32_t) ulTaskNotifyValueClearIndexed (thread_id,
+                                                  osSignalNotifyIndex,
+                                                  (uint32_t) signal);
 }
 
 /**
@@ -595,8 +649,22 @@ osSignalWait (int32_t signals, uint32_t millisec)
     }
   else
     {
-      if (xTaskNotifyWait (0, (uint32_t) signals,
-                           (uint32_t *) &ret.value.signals, ticks) != pdTRUE)
+#if (configUSE_TASK_NOTIFY_WAIT_BITS == 1)
+      // [ILG]
+      // Block until all the requested signals are set, or any signal
+      // if none is specified, and clear only those that were waited for.
+      BaseType_t wait_all = (signals != 0) ? pdTRUE : pdFALSE;
+      uint32_t mask = (signals != 0) ? (uint32_t) signals : 0x7FFFFFFFUL;
+
+      if (xTaskNotifyWaitBitsIndexed (osSignalNotifyIndex, mask, pdTRUE,
+                                      wait_all,
+                                      (uint32_t *) &ret.value.signals,
+                                      ticks) != pdTRUE)
+#else
+      if (xTaskNotifyWaitIndexed (osSignalNotifyIndex, 0, (uint32_t) signals,
+                                  (uint32_t *) &ret.value.signals,
+                                  ticks) != pdTRUE)
+#endif
         {
           if (ticks == 0)
             ret.status = osOK;
@@ -0,0 +1,234 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * µOS++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, version 3.
+ *
+ * µOS++ is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Cycle counts of the CMSIS++ operations implemented by the FreeRTOS
+ * port (cmsis-plus/include/cmsis-plus/rtos/port/os-inlines.h).
+ *
+ * It runs on a Cortex-M3/M4/M7 (the DWT cycle counter is used); see
+ * NOTES.md for how to build it. Run it once with the port to evaluate
+ * and once with the reference port, and compare the two listings; each
+ * line is the average number of cycles of one operation, including the
+ * call overhead.
+ */
+
+#include <cmsis-plus/rtos/os.h>
+#include <cmsis-plus/diag/trace.h>
+
+#include <cmsis_device.h>
+
+#include <cinttypes>
+
+using namespace os;
+using namespace os::rtos;
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  constexpr uint32_t iterations = 1000;
+
+  inline void
+  cycles_start (void)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+
+  inline uint32_t
+  cycles_now (void)
+  {
+    return DWT->CYCCNT;
+  }
+
+  uint32_t overhead;
+
+  void
+  report (const char* name, uint32_t total, uint32_t count = iterations)
+  {
+    uint32_t per_op = total / count;
+    per_op = (per_op > overhead) ? (per_op - overhead) : 0;
+    trace::printf ("%-40s %6" PRIu32 " cycles\n", name, per_op);
+  }
+
+  // Measure the expression over `iterations` consecutive runs.
+#define BENCH(name, expr) \
+  do \
+    { \
+      uint32_t bench_begin = cycles_now (); \
+      for (uint32_t bench_i = 0; bench_i < iterations; ++bench_i) \
+        { \
+          expr; \
+        } \
+      report (name, cycles_now () - bench_begin); \
+    } \
+  while (0)
+
+  mutex mx
+    { "mx" };
+  mutex rmx
+    { "rmx", mutex::initializer_recursive };
+  semaphore_binary sem
+    { "sem", 0 };
+  message_queue_typed<uint32_t> mq
+    { "mq", 4 };
+  event_flags ev
+    { "ev" };
+
+  // Objects a higher priority thread blocks on, so that each post,
+  // send or raise unblocks it and it blocks again before the call
+  // returns.
+  semaphore_binary ping_sem
+    { "ping_sem", 0 };
+  message_queue_typed<uint32_t> ping_mq
+    { "ping_mq", 1 };
+  event_flags ping_ev
+    { "ping_ev" };
+
+  volatile uint32_t sink;
+
+  void*
+  sleeper (void* args __attribute__((unused)))
+  {
+    for (;;)
+      {
+        this_thread::suspend ();
+      }
+    return nullptr;
+  }
+
+  thread_inclusive<1024> low
+    { "low", sleeper, nullptr };
+
+  void*
+  sem_waiter (void* args __attribute__((unused)))
+  {
+    for (;;)
+      {
+        ping_sem.wait ();
+      }
+    return nullptr;
+  }
+
+  void*
+  mq_receiver (void* args __attribute__((unused)))
+  {
+    uint32_t msg;
+    for (;;)
+      {
+        ping_mq.receive (&msg);
+      }
+    return nullptr;
+  }
+
+  void*
+  ev_waiter (void* args __attribute__((unused)))
+  {
+    for (;;)
+      {
+        ping_ev.wait (1);
+      }
+    return nullptr;
+  }
+
+  thread::attributes
+  high_attributes (void)
+  {
+    thread::attributes attr;
+    attr.th_priority = thread::priority::high;
+    return attr;
+  }
+
+  thread_inclusive<1024> sem_high
+    { "sem_high", sem_waiter, nullptr, high_attributes () };
+  thread_inclusive<1024> mq_high
+    { "mq_high", mq_receiver, nullptr, high_attributes () };
+  thread_inclusive<1024> ev_high
+    { "ev_high", ev_waiter, nullptr, high_attributes () };
+
+} /* namespace */
+
+// ----------------------------------------------------------------------------
+
+int
+os_main (int argc __attribute__((unused)), char* argv[] __attribute__((unused)))
+{
+  trace::printf ("CMSIS++ FreeRTOS port benchmark, %" PRIu32 " iterations.\n",
+                 iterations);
+
+  cycles_start ();
+
+  overhead = 0;
+  uint32_t t0 = cycles_now ();
+  for (uint32_t i = 0; i < iterations; ++i)
+    {
+      sink = i;
+    }
+  overhead = (cycles_now () - t0) / iterations;
+
+  // Mutexes, uncontended: the owner is recorded on each operation.
+  BENCH("mutex lock/unlock", mx.lock (); mx.unlock ());
+  BENCH("mutex try_lock/unlock", mx.try_lock (); mx.unlock ());
+  BENCH("recursive mutex lock/unlock", rmx.lock (); rmx.unlock ());
+
+  // Semaphores, queues and event flags, no waiting thread; the
+  // blocking calls find the object ready and do not block.
+  BENCH("semaphore post/try_wait", sem.post (); sem.try_wait ());
+  BENCH("semaphore post/wait", sem.post (); sem.wait ());
+  BENCH("semaphore post/timed_wait", sem.post (); sem.timed_wait (1));
+  uint32_t msg = 0;
+  BENCH("message_queue try_send/try_receive",
+        mq.try_send (&msg); mq.try_receive (&msg));
+  BENCH("message_queue send/receive", mq.send (&msg); mq.receive (&msg));
+  BENCH("message_queue timed_send/timed_receive",
+        mq.timed_send (&msg, 1); mq.timed_receive (&msg, 1));
+  BENCH("event_flags raise/try_wait", ev.raise (1); ev.try_wait (1));
+  BENCH("event_flags raise/wait", ev.raise (1); ev.wait (1));
+  BENCH("event_flags raise/timed_wait", ev.raise (1); ev.timed_wait (1, 1));
+  BENCH("event_flags raise/clear", ev.raise (1); ev.clear (1));
+
+  // A higher priority thread is blocked on the object; each call wakes
+  // it, switches to it, and switches back when it blocks again.
+  BENCH("semaphore post, waiter blocks again", ping_sem.post ());
+  BENCH("message_queue send, receiver blocks again", ping_mq.send (&msg));
+  BENCH("event_flags raise, waiter blocks again", ping_ev.raise (1));
+
+  // Priorities, no other thread becomes ready.
+  thread& self = this_thread::thread ();
+  thread::priority_t prio = self.priority ();
+  BENCH("thread priority set (same)", self.priority (prio));
+  BENCH("thread priority set (other, lower)",
+        low.priority (thread::priority::low));
+
+  // Resuming a lower priority thread, which need not preempt the caller;
+  // the time it then takes to run and suspend again is not counted.
+  low.priority (thread::priority::low);
+  uint32_t total = 0;
+  for (uint32_t i = 0; i < 100; ++i)
+    {
+      sysclock.sleep_for (1);
+      t0 = cycles_now ();
+      low.resume ();
+      total += cycles_now () - t0;
+    }
+  report ("thread resume (lower priority)", total, 100);
+
+  trace::printf ("Done.\n");
+  return 0;
+}
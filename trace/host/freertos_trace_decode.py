@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+#
+# This file is part of the µOS++ distribution.
+#   (https://github.com/micro-os-plus)
+# Copyright (c) 2016 Liviu Ionescu.
+#
+# Permission is hereby granted, free of charge, to any person
+# obtaining a copy of this software and associated documentation
+# files (the "Software"), to deal in the Software without
+# restriction, including without limitation the rights to use,
+# copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom
+# the Software is furnished to do so, subject to the following
+# conditions:
+#
+# The above copyright notice and this permission notice shall be
+# included in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+# OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+# HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+# WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+
+"""
+Decode a dump of the FreeRTOS binary trace recorder (xTraceRecorder).
+
+Usage:
+  freertos_trace_decode.py [--timeline] [--stats] [--hz N] trace.bin
+
+The dump is the raw memory of the xTraceRecorder structure, for example
+obtained with GDB:
+
+  (gdb) dump binary value trace.bin xTraceRecorder
+
+Without options, both the timeline and the statistics are printed.
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = 0x52544652
+HEADER = struct.Struct("<IHHIIII")
+EVENT = struct.Struct("<IBBH")
+
+# Keep in sync with trace/include/freertos_trace.h.
+EV_NAME = 0x01
+EVENTS = {
+    0x10: ("TASK_SWITCHED_IN", "task"),
+    0x11: ("TASK_READY", "task"),
+    0x12: ("TASK_CREATE", "task"),
+    0x13: ("TASK_DELETE", "task"),
+    0x14: ("TASK_DELAY", "task"),
+    0x15: ("TASK_DELAY_UNTIL", "task"),
+    0x16: ("TASK_PRIORITY_SET", "task"),
+    0x17: ("TASK_PRIORITY_INHERIT", "task"),
+    0x18: ("TASK_PRIORITY_DISINHERIT", "task"),
+    0x19: ("TASK_SUSPEND", "task"),
+    0x1A: ("TASK_RESUME", "task"),
+    0x1B: ("TASK_RESUME_FROM_ISR", "task"),
+    0x20: ("TICK", None),
+    0x30: ("QUEUE_CREATE", "object"),
+    0x31: ("QUEUE_DELETE", "object"),
+    0x32: ("QUEUE_SEND", "object"),
+    0x33: ("QUEUE_SEND_FAILED", "object"),
+    0x34: ("QUEUE_SEND_FROM_ISR", "object"),
+    0x35: ("QUEUE_SEND_FROM_ISR_FAILED", "object"),
+    0x36: ("QUEUE_RECEIVE", "object"),
+    0x37: ("QUEUE_RECEIVE_FAILED", "object"),
+    0x38: ("QUEUE_RECEIVE_FROM_ISR", "object"),
+    0x39: ("QUEUE_RECEIVE_FROM_ISR_FAILED", "object"),
+    0x3A: ("QUEUE_PEEK", "object"),
+    0x3B: ("QUEUE_BLOCK_ON_SEND", "object"),
+    0x3C: ("QUEUE_BLOCK_ON_RECEIVE", "object"),
+    0x3D: ("MUTEX_RECURSIVE_TAKE", "object"),
+    0x3E: ("MUTEX_RECURSIVE_GIVE", "object"),
+    0x40: ("TIMER_CREATE", "object"),
+    0x41: ("TIMER_COMMAND_SEND", "object"),
+    0x42: ("TIMER_COMMAND_RECEIVED", "object"),
+    0x43: ("TIMER_EXPIRED", "object"),
+    0x50: ("EVENT_GROUP_CREATE", "object"),
+    0x51: ("EVENT_GROUP_DELETE", "object"),
+    0x52: ("EVENT_GROUP_SET_BITS", "object"),
+    0x53: ("EVENT_GROUP_SET_BITS_FROM_ISR", "object"),
+    0x54: ("EVENT_GROUP_CLEAR_BITS", "object"),
+    0x55: ("EVENT_GROUP_WAIT_BLOCK", "object"),
+    0x56: ("EVENT_GROUP_WAIT_END", "object"),
+    0x57: ("EVENT_GROUP_SYNC_BLOCK", "object"),
+    0x58: ("EVENT_GROUP_SYNC_END", "object"),
+    0x60: ("TASK_NOTIFY", "task"),
+    0x61: ("TASK_NOTIFY_FROM_ISR", "task"),
+    0x62: ("TASK_NOTIFY_WAIT_BLOCK", "task"),
+    0x63: ("TASK_NOTIFY_WAIT", "task"),
+    0x70: ("MALLOC", None),
+    0x71: ("FREE", None),
+}
+OBJECT_CLASSES = {0: "task", 1: "object", 2: "object", 3: "object"}
+
+
+def read_events(data):
+    if len(data) < HEADER.size:
+        raise ValueError("dump too short")
+    magic, version, event_size, capacity, hz, head, _classes = \
+        HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        raise ValueError("bad magic 0x%08X, not a trace recorder dump" % magic)
+    if event_size != EVENT.size:
+        raise ValueError("unsupported event size %d" % event_size)
+    if len(data) < HEADER.size + capacity * event_size:
+        raise ValueError("dump truncated, expected %d events" % capacity)
+
+    if head <= capacity:
+        indices = range(head)
+    else:
+        # The buffer wrapped; the oldest event follows the newest.
+        first = head % capacity
+        indices = [(first + i) % capacity for i in range(capacity)]
+
+    events = [EVENT.unpack_from(data, HEADER.size + i * event_size)
+              for i in indices]
+    return version, hz, head, capacity, events
+
+
+class Decoder:
+
+    def __init__(self, hz):
+        self.hz = hz
+        self.names = {"task": {}, "object": {}}
+        self.partial = {}
+        self.last_raw = None
+        self.time = 0
+
+    def timestamp(self, raw):
+        # Unwrap the 32-bit counter; this assumes consecutive events are
+        # less than one counter period apart (enable the tick class for
+        # long idle periods).
+        if self.last_raw is not None:
+            self.time += (raw - self.last_raw) & 0xFFFFFFFF
+        self.last_raw = raw
+        return self.time
+
+    def name_chunk(self, param, obj, chars):
+        kind = OBJECT_CLASSES.get(param >> 4, "object")
+        chunk = param & 0x0F
+        key = (kind, obj)
+        text = struct.pack("<I", chars).split(b"\0")[0].decode(
+            "ascii", "replace")
+        if chunk == 0:
+            self.partial[key] = (0, text)
+        elif key in self.partial and self.partial[key][0] == chunk - 1:
+            self.partial[key] = (chunk, self.partial[key][1] + text)
+        else:
+            # The beginning of the name was overwritten.
+            return
+        self.names[kind][obj] = self.partial[key][1]
+
+    def name(self, kind, obj):
+        if kind is None:
+            return str(obj)
+        return self.names[kind].get(obj, "%s#%d" % (kind, obj))
+
+    def us(self, ticks):
+        if not self.hz:
+            return "%d" % ticks
+        return "%.3f" % (ticks * 1e6 / self.hz)
+
+
+def decode(events, hz, timeline, stats, out):
+    dec = Decoder(hz)
+
+    # Names may be emitted after the events that reference them were
+    # overwritten, so collect them first.
+    for ts, ev, param, obj in events:
+        if ev == EV_NAME:
+            dec.name_chunk(param, obj, ts)
+
+    tasks = {}
+    objects = {}
+    running = None
+    running_since = None
+    ready_at = {}
+
+    def task_stat(obj):
+        return tasks.setdefault(obj, {"switches": 0, "run": 0,
+                                      "max_latency": 0, "blocks": 0})
+
+    def object_stat(obj):
+        return objects.setdefault(obj, {})
+
+    unit = "us" if hz else "cycles"
+    if timeline:
+        out.write("%14s  %-30s %-16s %s\n" % ("time [%s]" % unit, "event",
+                                               "object", "param"))
+
+    for ts, ev, param, obj in events:
+        if ev == EV_NAME:
+            continue
+        t = dec.timestamp(ts)
+
+        if ev >= 0x80:
+            label, kind = ("USER_%d" % (ev & 0x7F), None)
+        else:
+            label, kind = EVENTS.get(ev, ("UNKNOWN_0x%02X" % ev, None))
+
+        if timeline:
+            out.write("%14s  %-30s %-16s %d\n" % (dec.us(t), label,
+                                                   dec.name(kind, obj), param))
+
+        if ev == 0x10:
+            if running is not None:
+                task_stat(running)["run"] += t - running_since
+            running, running_since = obj, t
+            st = task_stat(obj)
+            st["switches"] += 1
+            if obj in ready_at:
+                st["max_latency"] = max(st["max_latency"], t - ready_at.pop(obj))
+        elif ev == 0x11:
+            ready_at.setdefault(obj, t)
+        elif ev in (0x14, 0x15, 0x3B, 0x3C, 0x55, 0x57, 0x62):
+            blocked = obj if kind == "task" else running
+            if blocked is not None:
+                task_stat(blocked)["blocks"] += 1
+        if kind == "object":
+            st = object_stat(obj)
+            st[label] = st.get(label, 0) + 1
+            if label.startswith("QUEUE_SEND") or label.startswith(
+                    "QUEUE_RECEIVE"):
+                st["max_items"] = max(st.get("max_items", 0), param)
+
+    if running is not None and running_since is not None:
+        task_stat(running)["run"] += dec.time - running_since
+
+    if stats:
+        total = dec.time or 1
+        out.write("\nTasks (%s):\n" % unit)
+        out.write("%-16s %10s %14s %7s %14s %8s\n" % (
+            "task", "switches", "run", "cpu%", "max latency", "blocks"))
+        for obj in sorted(tasks):
+            st = tasks[obj]
+            out.write("%-16s %10d %14s %6.2f%% %14s %8d\n" % (
+                dec.name("task", obj), st["switches"], dec.us(st["run"]),
+                100.0 * st["run"] / total, dec.us(st["max_latency"]),
+                st["blocks"]))
+        if objects:
+            out.write("\nObjects:\n")
+            for obj in sorted(objects):
+                st = objects[obj]
+                counts = ", ".join("%s=%d" % (k, v) for k, v in sorted(
+                    st.items()))
+                out.write("%-16s %s\n" % (dec.name("object", obj), counts))
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(
+        description="Decode a FreeRTOS binary trace recorder dump.")
+    parser.add_argument("dump", help="raw dump of xTraceRecorder")
+    parser.add_argument("--timeline", action="store_true",
+                        help="print the timeline")
+    parser.add_argument("--stats", action="store_true",
+                        help="print the per task and per object statistics")
+    parser.add_argument("--hz", type=int, default=None,
+                        help="timestamp frequency, overrides the dump")
+    args = parser.parse_args(argv)
+
+    if not args.timeline and not args.stats:
+        args.timeline = args.stats = True
+
+    with open(args.dump, "rb") as f:
+        data = f.read()
+
+    try:
+        _version, hz, head, capacity, events = read_events(data)
+    except ValueError as e:
+        sys.stderr.write("error: %s\n" % e)
+        return 1
+
+    if args.hz is not None:
+        hz = args.hz
+
+    sys.stdout.write("%d events recorded, %d in the dump (capacity %d).\n" % (
+        head, len(events), capacity))
+    decode(events, hz, args.timeline, args.stats, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,384 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Binary in-RAM trace recorder, built on the FreeRTOS trace macros.
+ *
+ * To enable it, add the following at the end of FreeRTOSConfig.h:
+ *
+ *   #define configUSE_TRACE_RECORDER 1
+ *   #include "freertos_trace.h"
+ *
+ * and add `trace/src` to the source folders and `trace/include` to the
+ * include folders. configUSE_TRACE_FACILITY must also be 1, since the
+ * recorder identifies tasks and objects by the numbers kept in the
+ * kernel structures.
+ *
+ * Each kernel event is stored as an 8 bytes record (32-bit timestamp,
+ * event code, 8-bit parameter, 16-bit object number) in a ring buffer.
+ * Slots are reserved with an atomic increment, so recording is lock-free
+ * and can be done from any context; the cost is a mask test, the
+ * increment, the timestamp read and two stores.
+ *
+ * The `xTraceRecorder` structure is self describing; dump it from RAM
+ * (for example with GDB `dump binary value trace.bin xTraceRecorder`)
+ * and decode it with `trace/host/freertos_trace_decode.py`.
+ */
+
+#ifndef FREERTOS_TRACE_H_
+#define FREERTOS_TRACE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+#if ( configUSE_TRACE_FACILITY != 1 )
+	#error configUSE_TRACE_FACILITY must be set to 1 to use the trace recorder
+#endif
+
+/* Number of events in the ring buffer; must be a power of 2. */
+#ifndef configTRACE_RECORDER_BUFFER_EVENTS
+	#define configTRACE_RECORDER_BUFFER_EVENTS		( 1024 )
+#endif
+
+#if ( ( configTRACE_RECORDER_BUFFER_EVENTS & ( configTRACE_RECORDER_BUFFER_EVENTS - 1 ) ) != 0 )
+	#error configTRACE_RECORDER_BUFFER_EVENTS must be a power of 2
+#endif
+
+/* Set to 1 to stop recording when the buffer is full, instead of
+overwriting the oldest events. */
+#ifndef configTRACE_RECORDER_STOP_WHEN_FULL
+	#define configTRACE_RECORDER_STOP_WHEN_FULL		0
+#endif
+
+/* The event classes compiled in; classes not listed here cost nothing. */
+#ifndef configTRACE_RECORDER_CLASSES
+	#define configTRACE_RECORDER_CLASSES			( trcCLASS_ALL )
+#endif
+
+/* The free running 32-bit counter used to timestamp the events, and its
+frequency, which is only used by the host decoder to convert to time and is
+stored by vTraceRecorderInit(), so it need not be a constant.  On ARMv7-M the
+DWT cycle counter is used by default, and is enabled by vTraceRecorderInit(). */
+#ifndef configTRACE_RECORDER_TIMESTAMP
+	#if defined( __ARM_ARCH_7M__ ) || defined( __ARM_ARCH_7EM__ )
+		#define configTRACE_RECORDER_TIMESTAMP()	( *( ( volatile uint32_t * ) 0xE0001004UL ) )
+		#define trcUSE_DWT_CYCCNT					1
+	#else
+		#error configTRACE_RECORDER_TIMESTAMP() must be defined for this architecture
+	#endif
+#endif
+
+#ifndef configTRACE_RECORDER_TIMESTAMP_HZ
+	#define configTRACE_RECORDER_TIMESTAMP_HZ		( configCPU_CLOCK_HZ )
+#endif
+
+/* Event classes, selectable at compile time with
+configTRACE_RECORDER_CLASSES and at run time with vTraceRecorderStart(). */
+#define trcCLASS_TASK			( 0x0001UL )	/* Switches, ready, create, delete, priority, suspend, delay. */
+#define trcCLASS_TICK			( 0x0002UL )
+#define trcCLASS_QUEUE			( 0x0004UL )	/* Queues, semaphores and mutexes. */
+#define trcCLASS_TIMER			( 0x0008UL )
+#define trcCLASS_EVENT_GROUP	( 0x0010UL )
+#define trcCLASS_NOTIFY			( 0x0020UL )
+#define trcCLASS_HEAP			( 0x0040UL )
+#define trcCLASS_USER			( 0x0080UL )
+#define trcCLASS_ALL			( 0x00FFUL )
+
+/* Event codes.  Keep in sync with trace/host/freertos_trace_decode.py. */
+#define trcEVENT_NAME						( 0x01U )	/* Object name chunk; the timestamp holds 4 characters. */
+#define trcEVENT_TASK_SWITCHED_IN			( 0x10U )
+#define trcEVENT_TASK_READY					( 0x11U )
+#define trcEVENT_TASK_CREATE				( 0x12U )
+#define trcEVENT_TASK_DELETE				( 0x13U )
+#define trcEVENT_TASK_DELAY					( 0x14U )
+#define trcEVENT_TASK_DELAY_UNTIL			( 0x15U )
+#define trcEVENT_TASK_PRIORITY_SET			( 0x16U )
+#define trcEVENT_TASK_PRIORITY_INHERIT		( 0x17U )
+#define trcEVENT_TASK_PRIORITY_DISINHERIT	( 0x18U )
+#define trcEVENT_TASK_SUSPEND				( 0x19U )
+#define trcEVENT_TASK_RESUME				( 0x1AU )
+#define trcEVENT_TASK_RESUME_FROM_ISR		( 0x1BU )
+#define trcEVENT_TICK						( 0x20U )
+#define trcEVENT_QUEUE_CREATE				( 0x30U )
+#define trcEVENT_QUEUE_DELETE				( 0x31U )
+#define trcEVENT_QUEUE_SEND					( 0x32U )
+#define trcEVENT_QUEUE_SEND_FAILED			( 0x33U )
+#define trcEVENT_QUEUE_SEND_FROM_ISR		( 0x34U )
+#define trcEVENT_QUEUE_SEND_FROM_ISR_FAILED	( 0x35U )
+#define trcEVENT_QUEUE_RECEIVE				( 0x36U )
+#define trcEVENT_QUEUE_RECEIVE_FAILED		( 0x37U )
+#define trcEVENT_QUEUE_RECEIVE_FROM_ISR		( 0x38U )
+#define trcEVENT_QUEUE_RECEIVE_FROM_ISR_FAILED	( 0x39U )
+#define trcEVENT_QUEUE_PEEK					( 0x3AU )
+#define trcEVENT_QUEUE_BLOCK_ON_SEND		( 0x3BU )
+#define trcEVENT_QUEUE_BLOCK_ON_RECEIVE		( 0x3CU )
+#define trcEVENT_MUTEX_RECURSIVE_TAKE		( 0x3DU )
+#define trcEVENT_MUTEX_RECURSIVE_GIVE		( 0x3EU )
+#define trcEVENT_TIMER_CREATE				( 0x40U )
+#define trcEVENT_TIMER_COMMAND_SEND			( 0x41U )
+#define trcEVENT_TIMER_COMMAND_RECEIVED		( 0x42U )
+#define trcEVENT_TIMER_EXPIRED				( 0x43U )
+#define trcEVENT_EVENT_GROUP_CREATE			( 0x50U )
+#define trcEVENT_EVENT_GROUP_DELETE			( 0x51U )
+#define trcEVENT_EVENT_GROUP_SET_BITS		( 0x52U )
+#define trcEVENT_EVENT_GROUP_SET_BITS_FROM_ISR	( 0x53U )
+#define trcEVENT_EVENT_GROUP_CLEAR_BITS		( 0x54U )
+#define trcEVENT_EVENT_GROUP_WAIT_BLOCK		( 0x55U )
+#define trcEVENT_EVENT_GROUP_WAIT_END		( 0x56U )
+#define trcEVENT_EVENT_GROUP_SYNC_BLOCK		( 0x57U )
+#define trcEVENT_EVENT_GROUP_SYNC_END		( 0x58U )
+#define trcEVENT_TASK_NOTIFY				( 0x60U )
+#define trcEVENT_TASK_NOTIFY_FROM_ISR		( 0x61U )
+#define trcEVENT_TASK_NOTIFY_WAIT_BLOCK		( 0x62U )
+#define trcEVENT_TASK_NOTIFY_WAIT			( 0x63U )
+#define trcEVENT_MALLOC						( 0x70U )
+#define trcEVENT_FREE						( 0x71U )
+#define trcEVENT_USER						( 0x80U )	/* 0x80 to 0xFF are user events. */
+
+/* Object classes, used in the parameter of the trcEVENT_NAME records. */
+#define trcOBJECT_TASK			( 0U )
+#define trcOBJECT_QUEUE			( 1U )
+#define trcOBJECT_TIMER			( 2U )
+#define trcOBJECT_EVENT_GROUP	( 3U )
+
+#define trcRECORDER_MAGIC		( 0x52544652UL )	/* "FRTR" */
+#define trcRECORDER_VERSION		( 1U )
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct xTRACE_EVENT
+{
+	uint32_t ulTimestamp;
+	uint8_t ucEvent;
+	uint8_t ucParameter;
+	uint16_t usObject;
+} TraceEvent_t;
+
+typedef struct xTRACE_RECORDER
+{
+	uint32_t ulMagic;
+	uint16_t usVersion;
+	uint16_t usEventSize;
+	uint32_t ulCapacity;
+	uint32_t ulTimestampHz;
+	volatile uint32_t ulHead;		/* The number of events reserved so far; the oldest event is at ( ulHead - ulCapacity ) when the buffer has wrapped. */
+	volatile uint32_t ulClasses;	/* The classes currently recorded, 0 when stopped. */
+	TraceEvent_t xEvents[ configTRACE_RECORDER_BUFFER_EVENTS ];
+} TraceRecorder_t;
+
+extern TraceRecorder_t xTraceRecorder;
+
+void vTraceRecorderInit( void );
+void vTraceRecorderStart( uint32_t ulClasses );
+void vTraceRecorderStop( void );
+void vTraceRecorderClear( void );
+uint16_t usTraceRecorderNextObjectNumber( void );
+void vTraceRecorderName( uint8_t ucObjectClass, uint16_t usObject, const char *pcName );
+
+/* Reserve the next slot in the ring buffer, or return NULL if the buffer is
+full and configTRACE_RECORDER_STOP_WHEN_FULL is 1. */
+static inline __attribute__(( always_inline )) TraceEvent_t *pxTraceRecorderReserve( void )
+{
+uint32_t ulIndex;
+
+	#if ( defined( __ARM_ARCH_6M__ ) )
+	{
+		/* No exclusive access instructions on ARMv6-M. */
+		uint32_t ulPrimask;
+		__asm volatile( "mrs %0, primask \n cpsid i" : "=r" ( ulPrimask ) :: "memory" );
+		ulIndex = xTraceRecorder.ulHead++;
+		__asm volatile( "msr primask, %0" :: "r" ( ulPrimask ) : "memory" );
+	}
+	#else
+	{
+		ulIndex = __atomic_fetch_add( &xTraceRecorder.ulHead, 1UL, __ATOMIC_RELAXED );
+	}
+	#endif
+
+	#if ( configTRACE_RECORDER_STOP_WHEN_FULL == 1 )
+	{
+		if( ulIndex >= ( uint32_t ) configTRACE_RECORDER_BUFFER_EVENTS )
+		{
+			xTraceRecorder.ulClasses = 0;
+			return NULL;
+		}
+	}
+	#endif
+
+	return &( xTraceRecorder.xEvents[ ulIndex & ( ( uint32_t ) configTRACE_RECORDER_BUFFER_EVENTS - 1UL ) ] );
+}
+
+static inline __attribute__(( always_inline )) void vTraceRecorderWrite( uint8_t ucEvent, uint8_t ucParameter, uint16_t usObject )
+{
+TraceEvent_t *pxEvent = pxTraceRecorderReserve();
+
+	#if ( configTRACE_RECORDER_STOP_WHEN_FULL == 1 )
+	{
+		if( pxEvent == NULL )
+		{
+			return;
+		}
+	}
+	#endif
+
+	pxEvent->ulTimestamp = configTRACE_RECORDER_TIMESTAMP();
+	pxEvent->ucEvent = ucEvent;
+	pxEvent->ucParameter = ucParameter;
+	pxEvent->usObject = usObject;
+}
+
+/* Record the event if its class is compiled in and currently enabled. */
+#define trcRECORD( ulClass, ucEvent, uxParameter, uxObject )								\
+	do																						\
+	{																						\
+		if( ( ( ( configTRACE_RECORDER_CLASSES ) & ( ulClass ) ) != 0UL ) &&				\
+			( ( xTraceRecorder.ulClasses & ( ulClass ) ) != 0UL ) )							\
+		{																					\
+			vTraceRecorderWrite( ( ucEvent ), ( uint8_t ) ( uxParameter ), ( uint16_t ) ( uxObject ) ); \
+		}																					\
+	} while( 0 )
+
+/* Saturate counts stored in the 8-bit parameter. */
+#define trcCLIP8( x )	( ( ( x ) > 0xFFU ) ? 0xFFU : ( x ) )
+
+#define trcRECORD_NAME( ulClass, ucObjectClass, uxObject, pcName )							\
+	do																						\
+	{																						\
+		if( ( ( ( configTRACE_RECORDER_CLASSES ) & ( ulClass ) ) != 0UL ) &&				\
+			( ( xTraceRecorder.ulClasses & ( ulClass ) ) != 0UL ) && ( ( pcName ) != NULL ) ) \
+		{																					\
+			vTraceRecorderName( ( ucObjectClass ), ( uint16_t ) ( uxObject ), ( pcName ) );	\
+		}																					\
+	} while( 0 )
+
+/* Application events, code 0 to 127. */
+#define vTraceRecorderUserEvent( ucCode, usValue )	trcRECORD( trcCLASS_USER, ( uint8_t ) ( trcEVENT_USER | ( ( ucCode ) & 0x7FU ) ), 0U, ( usValue ) )
+
+#ifdef __cplusplus
+}
+#endif
+
+/*-----------------------------------------------------------
+ * The kernel trace macros.  They are expanded inside the kernel sources, so
+ * they have access to the private structures.
+ *----------------------------------------------------------*/
+
+/* Tasks. */
+#define traceTASK_SWITCHED_IN()					trcRECORD( trcCLASS_TASK, trcEVENT_TASK_SWITCHED_IN, pxCurrentTCB->uxPriority, pxCurrentTCB->uxTCBNumber )
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )	trcRECORD( trcCLASS_TASK, trcEVENT_TASK_READY, ( pxTCB )->uxPriority, ( pxTCB )->uxTCBNumber )
+#define traceTASK_CREATE( pxNewTCB )																	\
+	do																									\
+	{																									\
+		trcRECORD( trcCLASS_TASK, trcEVENT_TASK_CREATE, ( pxNewTCB )->uxPriority, ( pxNewTCB )->uxTCBNumber ); \
+		trcRECORD_NAME( trcCLASS_TASK, trcOBJECT_TASK, ( pxNewTCB )->uxTCBNumber, ( pxNewTCB )->pcTaskName ); \
+	} while( 0 )
+#define traceTASK_DELETE( pxTCB )				trcRECORD( trcCLASS_TASK, trcEVENT_TASK_DELETE, ( pxTCB )->uxPriority, ( pxTCB )->uxTCBNumber )
+#define traceTASK_DELAY()						trcRECORD( trcCLASS_TASK, trcEVENT_TASK_DELAY, 0U, pxCurrentTCB->uxTCBNumber )
+#define traceTASK_DELAY_UNTIL( x )				trcRECORD( trcCLASS_TASK, trcEVENT_TASK_DELAY_UNTIL, 0U, pxCurrentTCB->uxTCBNumber )
+#define traceTASK_PRIORITY_SET( pxTCB, uxNewPriority )	trcRECORD( trcCLASS_TASK, trcEVENT_TASK_PRIORITY_SET, ( uxNewPriority ), ( pxTCB )->uxTCBNumber )
+#define traceTASK_PRIORITY_INHERIT( pxTCB, uxPriority )	trcRECORD( trcCLASS_TASK, trcEVENT_TASK_PRIORITY_INHERIT, ( uxPriority ), ( pxTCB )->uxTCBNumber )
+#define traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriority )	trcRECORD( trcCLASS_TASK, trcEVENT_TASK_PRIORITY_DISINHERIT, ( uxPriority ), ( pxTCB )->uxTCBNumber )
+#define traceTASK_SUSPEND( pxTCB )				trcRECORD( trcCLASS_TASK, trcEVENT_TASK_SUSPEND, ( pxTCB )->uxPriority, ( pxTCB )->uxTCBNumber )
+#define traceTASK_RESUME( pxTCB )				trcRECORD( trcCLASS_TASK, trcEVENT_TASK_RESUME, ( pxTCB )->uxPriority, ( pxTCB )->uxTCBNumber )
+#define traceTASK_RESUME_FROM_ISR( pxTCB )		trcRECORD( trcCLASS_TASK, trcEVENT_TASK_RESUME_FROM_ISR, ( pxTCB )->uxPriority, ( pxTCB )->uxTCBNumber )
+
+/* Tick. */
+#define traceTASK_INCREMENT_TICK( xTickCount )	trcRECORD( trcCLASS_TICK, trcEVENT_TICK, 0U, ( xTickCount ) )
+
+/* Queues, semaphores and mutexes; the parameter is the number of items in
+the queue after the operation.  Object numbers are assigned at creation. */
+#define traceQUEUE_CREATE( pxNewQueue )																	\
+	do																									\
+	{																									\
+		( pxNewQueue )->uxQueueNumber = usTraceRecorderNextObjectNumber();								\
+		trcRECORD( trcCLASS_QUEUE, trcEVENT_QUEUE_CREATE, ( pxNewQueue )->ucQueueType, ( pxNewQueue )->uxQueueNumber ); \
+	} while( 0 )
+#define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName )	trcRECORD_NAME( trcCLASS_QUEUE, trcOBJECT_QUEUE, ( ( Queue_t * ) ( xQueue ) )->uxQueueNumber, ( pcQueueName ) )
+#define traceQUEUE_DELETE( pxQueue )			trcRECORD( trcCLASS_QUEUE, trcEVENT_QUEUE_DELETE, 0U, ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_SEND( pxQueue )				trcRECORD( trcCLASS_QUEUE, trcEVENT_QUEUE_SEND, trcCLIP8( ( pxQueue )->uxMessagesWaiting + 1U ), ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_SEND_FAILED( pxQueue )		trcRECORD( trcCLASS_QUEUE, trcEVENT_QUEUE_SEND_FAILED, trcCLIP8( ( pxQueue )->uxMessagesWaiting ), ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )		trcRECORD( trcCLASS_QUEUE, trcEVENT_QUEUE_SEND_FROM_ISR, trcCLIP8( ( pxQueue )->uxMessagesWaiting + 1U ), ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue )	trcRECORD( trcCLASS_QUEUE, trcEVENT_QUEUE_SEND_FROM_ISR_FAILED, trcCLIP8( ( pxQueue )->uxMessagesWaiting ), ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_RECEIVE( pxQueue )			trcRECORD( trcCLASS_QUEUE, trcEVENT_QUEUE_RECEIVE, trcCLIP8( ( pxQueue )->uxMessagesWaiting - 1U ), ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_RECEIVE_FAILED( pxQueue )	trcRECORD( trcCLASS_QUEUE, trcEVENT_QUEUE_RECEIVE_FAILED, trcCLIP8( ( pxQueue )->uxMessagesWaiting ), ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )	trcRECORD( trcCLASS_QUEUE, trcEVENT_QUEUE_RECEIVE_FROM_ISR, trcCLIP8( ( pxQueue )->uxMessagesWaiting - 1U ), ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue )	trcRECORD( trcCLASS_QUEUE, trcEVENT_QUEUE_RECEIVE_FROM_ISR_FAILED, trcCLIP8( ( pxQueue )->uxMessagesWaiting ), ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_PEEK( pxQueue )				trcRECORD( trcCLASS_QUEUE, trcEVENT_QUEUE_PEEK, trcCLIP8( ( pxQueue )->uxMessagesWaiting ), ( pxQueue )->uxQueueNumber )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )	trcRECORD( trcCLASS_QUEUE, trcEVENT_QUEUE_BLOCK_ON_SEND, trcCLIP8( ( pxQueue )->uxMessagesWaiting ), ( pxQueue )->uxQueueNumber )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )	trcRECORD( trcCLASS_QUEUE, trcEVENT_QUEUE_BLOCK_ON_RECEIVE, trcCLIP8( ( pxQueue )->uxMessagesWaiting ), ( pxQueue )->uxQueueNumber )
+#define traceTAKE_MUTEX_RECURSIVE( pxMutex )	trcRECORD( trcCLASS_QUEUE, trcEVENT_MUTEX_RECURSIVE_TAKE, trcCLIP8( ( pxMutex )->u.uxRecursiveCallCount ), ( pxMutex )->uxQueueNumber )
+#define traceGIVE_MUTEX_RECURSIVE( pxMutex )	trcRECORD( trcCLASS_QUEUE, trcEVENT_MUTEX_RECURSIVE_GIVE, trcCLIP8( ( pxMutex )->u.uxRecursiveCallCount ), ( pxMutex )->uxQueueNumber )
+
+/* Software timers. */
+#define traceTIMER_CREATE( pxNewTimer )																	\
+	do																									\
+	{																									\
+		( pxNewTimer )->uxTimerNumber = usTraceRecorderNextObjectNumber();								\
+		trcRECORD( trcCLASS_TIMER, trcEVENT_TIMER_CREATE, ( pxNewTimer )->uxAutoReload, ( pxNewTimer )->uxTimerNumber ); \
+		trcRECORD_NAME( trcCLASS_TIMER, trcOBJECT_TIMER, ( pxNewTimer )->uxTimerNumber, ( pxNewTimer )->pcTimerName ); \
+	} while( 0 )
+#define traceTIMER_COMMAND_SEND( xTimer, xMessageID, xMessageValue, xReturn )	trcRECORD( trcCLASS_TIMER, trcEVENT_TIMER_COMMAND_SEND, ( xMessageID ), ( ( Timer_t * ) ( xTimer ) )->uxTimerNumber )
+#define traceTIMER_COMMAND_RECEIVED( pxTimer, xMessageID, xMessageValue )	trcRECORD( trcCLASS_TIMER, trcEVENT_TIMER_COMMAND_RECEIVED, ( xMessageID ), ( pxTimer )->uxTimerNumber )
+#define traceTIMER_EXPIRED( pxTimer )			trcRECORD( trcCLASS_TIMER, trcEVENT_TIMER_EXPIRED, 0U, ( pxTimer )->uxTimerNumber )
+
+/* Event groups; the parameter holds the low 8 bits of the mask. */
+#define traceEVENT_GROUP_CREATE( xEventGroup )															\
+	do																									\
+	{																									\
+		( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber = usTraceRecorderNextObjectNumber();	\
+		trcRECORD( trcCLASS_EVENT_GROUP, trcEVENT_EVENT_GROUP_CREATE, 0U, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber ); \
+	} while( 0 )
+#define traceEVENT_GROUP_DELETE( xEventGroup )	trcRECORD( trcCLASS_EVENT_GROUP, trcEVENT_EVENT_GROUP_DELETE, 0U, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber )
+#define traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet )	trcRECORD( trcCLASS_EVENT_GROUP, trcEVENT_EVENT_GROUP_SET_BITS, ( uxBitsToSet ) & 0xFFU, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber )
+#define traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet )	trcRECORD( trcCLASS_EVENT_GROUP, trcEVENT_EVENT_GROUP_SET_BITS_FROM_ISR, ( uxBitsToSet ) & 0xFFU, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber )
+#define traceEVENT_GROUP_CLEAR_BITS( xEventGroup, uxBitsToClear )	trcRECORD( trcCLASS_EVENT_GROUP, trcEVENT_EVENT_GROUP_CLEAR_BITS, ( uxBitsToClear ) & 0xFFU, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber )
+#define traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear )	traceEVENT_GROUP_CLEAR_BITS( xEventGroup, uxBitsToClear )
+#define traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor )	trcRECORD( trcCLASS_EVENT_GROUP, trcEVENT_EVENT_GROUP_WAIT_BLOCK, ( uxBitsToWaitFor ) & 0xFFU, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber )
+#define traceEVENT_GROUP_WAIT_BITS_END( xEventGroup, uxBitsToWaitFor, xTimeoutOccurred )	trcRECORD( trcCLASS_EVENT_GROUP, trcEVENT_EVENT_GROUP_WAIT_END, ( xTimeoutOccurred ), ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber )
+#define traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor )	trcRECORD( trcCLASS_EVENT_GROUP, trcEVENT_EVENT_GROUP_SYNC_BLOCK, ( uxBitsToWaitFor ) & 0xFFU, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber )
+#define traceEVENT_GROUP_SYNC_END( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTimeoutOccurred )	trcRECORD( trcCLASS_EVENT_GROUP, trcEVENT_EVENT_GROUP_SYNC_END, ( xTimeoutOccurred ), ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber )
+
+/* Task notifications; the object is the notified or the waiting task. */
+#define traceTASK_NOTIFY()						trcRECORD( trcCLASS_NOTIFY, trcEVENT_TASK_NOTIFY, 0U, pxTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_FROM_ISR()				trcRECORD( trcCLASS_NOTIFY, trcEVENT_TASK_NOTIFY_FROM_ISR, 0U, pxTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_GIVE_FROM_ISR()		trcRECORD( trcCLASS_NOTIFY, trcEVENT_TASK_NOTIFY_FROM_ISR, 1U, pxTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_TAKE_BLOCK()			trcRECORD( trcCLASS_NOTIFY, trcEVENT_TASK_NOTIFY_WAIT_BLOCK, 1U, pxCurrentTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_TAKE()					trcRECORD( trcCLASS_NOTIFY, trcEVENT_TASK_NOTIFY_WAIT, 1U, pxCurrentTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_WAIT_BLOCK()			trcRECORD( trcCLASS_NOTIFY, trcEVENT_TASK_NOTIFY_WAIT_BLOCK, 0U, pxCurrentTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_WAIT()					trcRECORD( trcCLASS_NOTIFY, trcEVENT_TASK_NOTIFY_WAIT, 0U, pxCurrentTCB->uxTCBNumber )
+
+/* Heap; the object holds the size, saturated to 16 bits. */
+#define traceMALLOC( pvAddress, uiSize )		trcRECORD( trcCLASS_HEAP, trcEVENT_MALLOC, ( ( pvAddress ) != NULL ), ( ( uiSize ) > 0xFFFFU ) ? 0xFFFFU : ( uiSize ) )
+#define traceFREE( pvAddress, uiSize )			trcRECORD( trcCLASS_HEAP, trcEVENT_FREE, 0U, ( ( uiSize ) > 0xFFFFU ) ? 0xFFFFU : ( uiSize ) )
+
+#endif /* configUSE_TRACE_RECORDER == 1 */
+
+#endif /* FREERTOS_TRACE_H_ */
@@ -0,0 +1,165 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus)
+ * Copyright (c) 2016 Liviu Ionescu.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Binary in-RAM trace recorder; see trace/include/freertos_trace.h.
+ */
+
+#include "FreeRTOS.h"
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+#include "freertos_trace.h"
+
+/* Statically initialised, so that a dump taken before the recorder is
+started still describes itself.  The timestamp frequency is set by
+vTraceRecorderInit(), as configCPU_CLOCK_HZ is often a variable (such as
+SystemCoreClock) rather than a constant; until then it is 0, which the decoder
+shows as raw counts. */
+TraceRecorder_t xTraceRecorder =
+{
+	trcRECORDER_MAGIC,
+	trcRECORDER_VERSION,
+	( uint16_t ) sizeof( TraceEvent_t ),
+	( uint32_t ) configTRACE_RECORDER_BUFFER_EVENTS,
+	0UL,
+	0UL,
+	0UL,
+	{ { 0UL, 0U, 0U, 0U } }
+};
+
+/* Object numbers for queues, timers and event groups; tasks use the number
+the kernel keeps in the TCB.  0 means "not numbered". */
+static volatile uint32_t ulNextObjectNumber = 0UL;
+
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderInit( void )
+{
+	#if ( defined( trcUSE_DWT_CYCCNT ) )
+	{
+		/* Enable the trace block (DEMCR.TRCENA) and the cycle counter
+		(DWT_CTRL.CYCCNTENA). */
+		*( ( volatile uint32_t * ) 0xE000EDFCUL ) |= ( 1UL << 24UL );
+		*( ( volatile uint32_t * ) 0xE0001000UL ) |= 1UL;
+	}
+	#endif
+
+	xTraceRecorder.ulTimestampHz = ( uint32_t ) configTRACE_RECORDER_TIMESTAMP_HZ;
+
+	vTraceRecorderStop();
+	vTraceRecorderClear();
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStart( uint32_t ulClasses )
+{
+	xTraceRecorder.ulClasses = ulClasses & ( uint32_t ) ( configTRACE_RECORDER_CLASSES );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStop( void )
+{
+	xTraceRecorder.ulClasses = 0UL;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderClear( void )
+{
+	/* Only meaningful while stopped, otherwise an event may be reserved
+	just before the head is reset. */
+	xTraceRecorder.ulHead = 0UL;
+}
+/*-----------------------------------------------------------*/
+
+uint16_t usTraceRecorderNextObjectNumber( void )
+{
+uint32_t ulNumber;
+
+	#if ( defined( __ARM_ARCH_6M__ ) )
+	{
+		UBaseType_t uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ulNumber = ++ulNextObjectNumber;
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	#else
+	{
+		ulNumber = __atomic_add_fetch( &ulNextObjectNumber, 1UL, __ATOMIC_RELAXED );
+	}
+	#endif
+
+	return ( uint16_t ) ulNumber;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderName( uint8_t ucObjectClass, uint16_t usObject, const char *pcName )
+{
+TraceEvent_t *pxEvent;
+uint32_t ulChars;
+uint8_t ucChunk, ucByte;
+const uint8_t ucMaxChunks = 4U;
+
+	/* The name is split in chunks of 4 characters, stored in the timestamp
+	field of consecutive trcEVENT_NAME records, little endian.  The parameter
+	holds the object class in the high nibble and the chunk index in the low
+	nibble.  The last chunk is padded with zeros. */
+	for( ucChunk = 0U; ucChunk < ucMaxChunks; ucChunk++ )
+	{
+		ulChars = 0UL;
+		for( ucByte = 0U; ucByte < 4U; ucByte++ )
+		{
+			if( *pcName == '\0' )
+			{
+				break;
+			}
+			ulChars |= ( ( uint32_t ) ( uint8_t ) *pcName ) << ( ucByte * 8U );
+			pcName++;
+		}
+
+		pxEvent = pxTraceRecorderReserve();
+		if( pxEvent == NULL )
+		{
+			break;
+		}
+
+		pxEvent->ulTimestamp = ulChars;
+		pxEvent->ucEvent = trcEVENT_NAME;
+		pxEvent->ucParameter = ( uint8_t ) ( ( ucObjectClass << 4U ) | ucChunk );
+		pxEvent->usObject = usObject;
+
+		if( ( ucByte < 4U ) || ( *pcName == '\0' ) )
+		{
+			break;
+		}
+	}
+}
+
+#endif /* configUSE_TRACE_RECORDER == 1 */